@@ -0,0 +1,22 @@
+#ifndef ALLOCATIONCOUNTER_HPP
+#define ALLOCATIONCOUNTER_HPP
+
+#include <cstddef>
+
+/**
+ * Counts the calls to operator new of the whole program, and the bytes they
+ * asked for, from its creation. The bench target replaces the global
+ * operator new to keep the totals.
+ */
+class AllocationCounter {
+ public:
+  AllocationCounter();
+
+  size_t allocations() const;
+  size_t bytes() const;
+
+ private:
+  size_t _allocations, _bytes;
+};
+
+#endif  // ALLOCATIONCOUNTER_HPP
@@ -0,0 +1,32 @@
+#ifndef QUIETOUTPUT_HPP
+#define QUIETOUTPUT_HPP
+
+#include <iostream>
+#include <streambuf>
+
+/**
+ * Discards what is written to std::cout while it exists, so that the
+ * messages of the loaders don't interleave with the benchmark results
+ */
+class QuietOutput {
+ public:
+  QuietOutput() : _previous(std::cout.rdbuf(&_buffer)) {}
+  ~QuietOutput() { std::cout.rdbuf(_previous); }
+
+  QuietOutput(const QuietOutput&) = delete;
+  QuietOutput& operator=(const QuietOutput&) = delete;
+
+ private:
+  class NullBuffer : public std::streambuf {
+   protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize count) override {
+      return count;
+    }
+  };
+
+  NullBuffer _buffer;
+  std::streambuf* _previous;
+};
+
+#endif  // QUIETOUTPUT_HPP
@@ -0,0 +1,63 @@
+#include "allocationCounter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Totals since the program started
+static std::atomic<size_t> allocationTotal{0};
+static std::atomic<size_t> byteTotal{0};
+
+static void* allocate(size_t size, size_t alignment) {
+  allocationTotal.fetch_add(1, std::memory_order_relaxed);
+  byteTotal.fetch_add(size, std::memory_order_relaxed);
+
+  if (size == 0) {
+    size = 1;
+  }
+  void* pointer;
+  if (alignment > alignof(std::max_align_t)) {
+    // aligned_alloc wants a multiple of the alignment
+    size_t rounded = (size + alignment - 1) / alignment * alignment;
+    pointer = std::aligned_alloc(alignment, rounded);
+  } else {
+    pointer = std::malloc(size);
+  }
+  if (!pointer) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+// The array and nothrow forms call these
+void* operator new(size_t size) {
+  return allocate(size, alignof(std::max_align_t));
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+  return allocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, size_t) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept {
+  std::free(pointer);
+}
+
+AllocationCounter::AllocationCounter()
+    : _allocations(allocationTotal.load(std::memory_order_relaxed)),
+      _bytes(byteTotal.load(std::memory_order_relaxed)) {}
+
+size_t AllocationCounter::allocations() const {
+  return allocationTotal.load(std::memory_order_relaxed) - _allocations;
+}
+
+size_t AllocationCounter::bytes() const {
+  return byteTotal.load(std::memory_order_relaxed) - _bytes;
+}
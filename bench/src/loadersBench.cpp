@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "Model.hpp"
+#include "quietOutput.hpp"
+#include "readFile.hpp"
+#include "utils.hpp"
+
+// Simple .3d files: one "x y z" line per triangle corner
+static void BM_Parse3Dfile(benchmark::State& state, const char* file) {
+  size_t points = 0;
+  for (auto _ : state) {
+    std::vector<Point> read = parse3Dfile(file);
+    points = read.size();
+    benchmark::DoNotOptimize(read.data());
+  }
+  state.SetItemsProcessed(state.iterations() * points);
+}
+BENCHMARK_CAPTURE(BM_Parse3Dfile, planet, "models/planet.3d");
+BENCHMARK_CAPTURE(BM_Parse3Dfile, bezier_100, "models/bezier_100.3d");
+
+static void BM_ParseOBJfile(benchmark::State& state, const char* file) {
+  size_t points = 0;
+  for (auto _ : state) {
+    std::vector<Point> read = parseOBJfile(file);
+    points = read.size();
+    benchmark::DoNotOptimize(read.data());
+  }
+  state.SetItemsProcessed(state.iterations() * points);
+}
+BENCHMARK_CAPTURE(BM_ParseOBJfile, pato, "models/pato.obj");
+BENCHMARK_CAPTURE(BM_ParseOBJfile, coelho, "models/coelho.obj");
+BENCHMARK_CAPTURE(BM_ParseOBJfile, porsche, "models/porsche.obj");
+
+/**
+ * Reads a model on every iteration, welding its vertices unless the file
+ * is indexed, and reports the triangles read per second
+ */
+template <typename Read>
+static void readModel(benchmark::State& state, const char* file,
+                      const Read& read) {
+  QuietOutput quiet;
+  size_t triangles = 0;
+  for (auto _ : state) {
+    Model model = read(file);
+    triangles = model.mesh->ibo.size() / 3;
+    benchmark::DoNotOptimize(model.mesh->vbo.data());
+  }
+  state.SetItemsProcessed(state.iterations() * triangles);
+}
+
+static void BM_ReadOBJfile(benchmark::State& state, const char* file) {
+  readModel(state, file, readOBJfile);
+}
+BENCHMARK_CAPTURE(BM_ReadOBJfile, pato, "models/pato.obj");
+BENCHMARK_CAPTURE(BM_ReadOBJfile, porsche, "models/porsche.obj");
+
+// .3d files with a "# <count>" header and normals and texture coordinates
+static void BM_Read3DAdvancedFile(benchmark::State& state, const char* file) {
+  readModel(state, file, read3DAdvancedFile);
+}
+BENCHMARK_CAPTURE(BM_Read3DAdvancedFile, sphere, "models/sphere.3d");
+BENCHMARK_CAPTURE(BM_Read3DAdvancedFile, teapot, "models/teapot.3d");
+BENCHMARK_CAPTURE(BM_Read3DAdvancedFile, comet, "models/comet.3d");
+
+// Every triangle corner of a model, as the unindexed formats hold them
+static std::vector<Vertex> triangleCorners(const char* file) {
+  QuietOutput quiet;
+  Model model = read3DAdvancedFile(file);
+  std::vector<Vertex> corners;
+  corners.reserve(model.mesh->ibo.size());
+  for (unsigned int index : model.mesh->ibo) {
+    corners.push_back(model.mesh->vbo[index]);
+  }
+  return corners;
+}
+
+static void BM_CreateVertexBuffer(benchmark::State& state, const char* file) {
+  std::vector<Vertex> corners = triangleCorners(file);
+  for (auto _ : state) {
+    std::vector<Vertex> vbo = createVertexBuffer(corners);
+    benchmark::DoNotOptimize(vbo.data());
+  }
+  state.SetItemsProcessed(state.iterations() * corners.size());
+}
+BENCHMARK_CAPTURE(BM_CreateVertexBuffer, teapot, "models/teapot.3d");
+BENCHMARK_CAPTURE(BM_CreateVertexBuffer, comet, "models/comet.3d");
+
+static void BM_CreateIndexBuffer(benchmark::State& state, const char* file) {
+  std::vector<Vertex> corners = triangleCorners(file);
+  std::vector<Vertex> vbo = createVertexBuffer(corners);
+  for (auto _ : state) {
+    std::vector<unsigned int> ibo = createIndexBuffer(corners, vbo);
+    benchmark::DoNotOptimize(ibo.data());
+  }
+  state.SetItemsProcessed(state.iterations() * corners.size());
+}
+BENCHMARK_CAPTURE(BM_CreateIndexBuffer, teapot, "models/teapot.3d");
+BENCHMARK_CAPTURE(BM_CreateIndexBuffer, comet, "models/comet.3d");
@@ -0,0 +1,40 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+  // Results are written where the benchmarks were started from, though
+  // they run in the repository, on its models and scenes
+  const std::string OUT = "--benchmark_out=";
+  std::vector<std::string> arguments(argv, argv + argc);
+  for (std::string& argument : arguments) {
+    if (argument.rfind(OUT, 0) == 0) {
+      argument = OUT + std::filesystem::absolute(argument.substr(OUT.size()))
+                           .string();
+    }
+  }
+  std::vector<char*> pointers;
+  for (std::string& argument : arguments) {
+    pointers.push_back(argument.data());
+  }
+  int count = static_cast<int>(pointers.size());
+
+  std::error_code error;
+  std::filesystem::current_path(BENCH_DATA_DIR, error);
+  if (error) {
+    std::cerr << "Can't open " << BENCH_DATA_DIR << ": " << error.message()
+              << std::endl;
+    return 1;
+  }
+
+  benchmark::Initialize(&count, pointers.data());
+  if (benchmark::ReportUnrecognizedArguments(count, pointers.data())) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
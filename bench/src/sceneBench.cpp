@@ -0,0 +1,247 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "allocationCounter.hpp"
+#include "bvh.hpp"
+#include "catmullCurves.hpp"
+#include "filesParser.hpp"
+#include "frameStats.hpp"
+#include "jobSystem.hpp"
+#include "quietOutput.hpp"
+#include "readFile.hpp"
+#include "sceneGraph.hpp"
+
+// Evaluations per iteration, spread over the whole loop
+static const int CURVE_SAMPLES = 1000;
+
+/**
+ * Control points on a circle of radius 10
+ */
+static std::vector<Point> circleCurve(int points) {
+  std::vector<Point> curve;
+  for (int i = 0; i < points; i++) {
+    float angle = 2.0f * static_cast<float>(M_PI) * i / points;
+    curve.emplace_back(10 * std::cos(angle), 0, 10 * std::sin(angle));
+  }
+  return curve;
+}
+
+static void BM_CatmollRomPosition(benchmark::State& state) {
+  std::vector<Point> curve = circleCurve(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    for (int i = 0; i < CURVE_SAMPLES; i++) {
+      auto [position, tangent] = catmollRomPosition(
+          curve, static_cast<float>(i) / CURVE_SAMPLES);
+      benchmark::DoNotOptimize(position);
+      benchmark::DoNotOptimize(tangent);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * CURVE_SAMPLES);
+}
+BENCHMARK(BM_CatmollRomPosition)->Arg(4)->Arg(16)->Arg(64);
+
+/**
+ * The same curves evaluated as the scene does, from the segment
+ * coefficients precomputed by TimeTranslations, at uniform parameter or at
+ * constant speed along the arc length
+ */
+static void BM_CurveEvaluate(benchmark::State& state, bool constantSpeed) {
+  std::vector<Point> points = circleCurve(static_cast<int>(state.range(0)));
+  TimeTranslations translation(
+      10.0f, false, std::pmr::vector<Point>(points.begin(), points.end()),
+      constantSpeed);
+  for (auto _ : state) {
+    for (int i = 0; i < CURVE_SAMPLES; i++) {
+      auto [position, tangent] =
+          translation.evaluate(static_cast<float>(i) / CURVE_SAMPLES);
+      benchmark::DoNotOptimize(position);
+      benchmark::DoNotOptimize(tangent);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * CURVE_SAMPLES);
+}
+BENCHMARK_CAPTURE(BM_CurveEvaluate, uniform, false)
+    ->Arg(4)
+    ->Arg(16)
+    ->Arg(64);
+BENCHMARK_CAPTURE(BM_CurveEvaluate, constant_speed, true)
+    ->Arg(4)
+    ->Arg(16)
+    ->Arg(64);
+
+/**
+ * Loads a bundled scene on every iteration. The models and textures read
+ * by the previous iteration are released first, so every load reads its
+ * files again.
+ */
+static void BM_ParseConfig(benchmark::State& state, const char* scene) {
+  QuietOutput quiet;
+  for (auto _ : state) {
+    state.PauseTiming();
+    releaseModels();
+    releaseTextures();
+    state.ResumeTiming();
+
+    Configuration configuration = parseConfig(scene);
+    benchmark::DoNotOptimize(&configuration);
+  }
+}
+BENCHMARK_CAPTURE(BM_ParseConfig, default, "scenes/default.xml")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_ParseConfig, scene_teapot, "scenes/scene_teapot.xml")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_ParseConfig, comet, "scenes/comet.xml")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_ParseConfig, solar, "scenes/solar.xml")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_ParseConfig, solar_system, "scenes/solar_system.xml")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_ParseConfig, solar_system_align,
+                  "scenes/solar_system_align.xml")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+/**
+ * Adds the meshes of every model of the group to the set, and their files
+ */
+static void collectMeshes(const ModelGroup& group,
+                          std::set<const Mesh*>& meshes,
+                          std::set<std::string>& files) {
+  for (const Model& model : group.models) {
+    meshes.insert(model.mesh.get());
+    files.insert(model.filename);
+  }
+  for (const InstanceSet& set : group.instances) {
+    meshes.insert(set.model.mesh.get());
+    files.insert(set.model.filename);
+  }
+  for (const ModelGroup& subgroup : group.subModelgroups) {
+    collectMeshes(subgroup, meshes, files);
+  }
+}
+
+/**
+ * Loads a bundled scene with the models already cached, as a reload does,
+ * and reports the allocations and the bytes allocated per load. Building
+ * the scene moves its groups and shares one mesh per file, so these stay
+ * far below the size of the meshes; a load that copies meshes again shows
+ * up in the counters, and fails if the models stop sharing them.
+ */
+static void BM_ParseConfigAllocations(benchmark::State& state,
+                                      const char* scene) {
+  QuietOutput quiet;
+  parseConfig(scene);  // Fills the model cache
+
+  size_t allocations = 0, bytes = 0;
+  for (auto _ : state) {
+    AllocationCounter counter;
+    Configuration configuration = parseConfig(scene);
+    allocations += counter.allocations();
+    bytes += counter.bytes();
+
+    state.PauseTiming();
+    std::set<const Mesh*> meshes;
+    std::set<std::string> files;
+    collectMeshes(configuration.modelGroup, meshes, files);
+    if (meshes.size() > files.size()) {
+      state.SkipWithError("models of the same file don't share their mesh");
+      break;
+    }
+    state.ResumeTiming();
+  }
+  state.counters["allocations"] =
+      benchmark::Counter(static_cast<double>(allocations),
+                         benchmark::Counter::kAvgIterations);
+  state.counters["bytes"] = benchmark::Counter(
+      static_cast<double>(bytes), benchmark::Counter::kAvgIterations,
+      benchmark::Counter::OneK::kIs1024);
+}
+BENCHMARK_CAPTURE(BM_ParseConfigAllocations, solar, "scenes/solar.xml")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_ParseConfigAllocations, solar_system,
+                  "scenes/solar_system.xml")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+/**
+ * One simulation step of a bundled scene per iteration, as the engine runs
+ * it before drawing: the transform update at the next 1/60 s and the BVH
+ * refit. The argument is the number of threads of the update.
+ */
+static void BM_SceneUpdate(benchmark::State& state, const char* scene) {
+  if (!*scene) {
+    state.SkipWithError("scene not generated (Python was not found)");
+    return;
+  }
+  QuietOutput quiet;
+  Configuration configuration = parseConfig(scene);
+
+  std::unique_ptr<JobSystem> jobs;
+  SceneGraph graph;
+  graph.build(configuration.modelGroup);
+  if (state.range(0) > 1) {
+    jobs =
+        std::make_unique<JobSystem>(static_cast<unsigned>(state.range(0)));
+    graph.setJobSystem(jobs.get());
+  }
+  BVH bvh;
+
+  int frame = 0;
+  for (auto _ : state) {
+    FrameStats stats;
+    graph.update(static_cast<float>(frame++) / 60.0f, stats);
+    if (!bvh.built()) {
+      bvh.build(graph);
+    } else {
+      bvh.refit(graph);
+    }
+    benchmark::DoNotOptimize(stats);
+  }
+  state.SetItemsProcessed(state.iterations() * graph.size());
+}
+BENCHMARK_CAPTURE(BM_SceneUpdate, solar, "scenes/solar.xml")
+    ->ArgName("threads")
+    ->Arg(1)
+    ->Arg(4)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_SceneUpdate, solar_system, "scenes/solar_system.xml")
+    ->ArgName("threads")
+    ->Arg(1)
+    ->Arg(4)
+    ->UseRealTime();
+
+#ifndef BENCH_SYNTHETIC_SCENE
+#define BENCH_SYNTHETIC_SCENE ""
+#endif
+
+/**
+ * 1, 2 and 4 threads and every core, to compare the scaling of the update
+ * against the ideal linear one
+ */
+static void threadCounts(benchmark::internal::Benchmark* benchmark) {
+  int cores = static_cast<int>(std::thread::hardware_concurrency());
+  benchmark->ArgName("threads");
+  for (int threads : {1, 2, 4}) {
+    benchmark->Arg(threads);
+  }
+  if (cores > 4) {
+    benchmark->Arg(cores);
+  }
+}
+
+// Generated by the build with scripts/generate_synthetic_scene.py
+BENCHMARK_CAPTURE(BM_SceneUpdate, synthetic_100k, BENCH_SYNTHETIC_SCENE)
+    ->Apply(threadCounts)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
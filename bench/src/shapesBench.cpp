@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "indexedMesh.hpp"
+#include "quietOutput.hpp"
+#include "shapes/cone.hpp"
+#include "shapes/cube.hpp"
+#include "shapes/cylinder.hpp"
+#include "shapes/donut.hpp"
+#include "shapes/geosphere.hpp"
+#include "shapes/patches.hpp"
+#include "shapes/plane.hpp"
+#include "shapes/sphere.hpp"
+
+/**
+ * Builds a figure in memory on every iteration, and reports its triangles
+ * and the triangles built per second
+ */
+template <typename Build>
+static void buildFigure(benchmark::State& state, const Build& build) {
+  size_t triangles = 0;
+  for (auto _ : state) {
+    IndexedMesh mesh;
+    build(static_cast<MeshSink&>(mesh));
+    triangles = mesh.triangleCount();
+    benchmark::DoNotOptimize(mesh.indices.data());
+  }
+  state.SetItemsProcessed(state.iterations() * triangles);
+  state.counters["triangles"] = static_cast<double>(triangles);
+}
+
+// The patches of the teapot, read once
+static const std::vector<PatchPoints>& teapot() {
+  static const std::vector<PatchPoints> patches = [] {
+    QuietOutput quiet;
+    std::vector<PatchPoints> read;
+    readPatchFile("models/teapot.patch", read);
+    return read;
+  }();
+  return patches;
+}
+
+static void BM_Plane(benchmark::State& state) {
+  int divisions = static_cast<int>(state.range(0));
+  buildFigure(state,
+              [&](MeshSink& mesh) { generatePlaneData(2, divisions, mesh); });
+}
+BENCHMARK(BM_Plane)->Arg(16)->Arg(128)->Arg(1024);
+
+static void BM_Box(benchmark::State& state) {
+  int divisions = static_cast<int>(state.range(0));
+  buildFigure(state,
+              [&](MeshSink& mesh) { cubeAllPoints(2, divisions, mesh); });
+}
+BENCHMARK(BM_Box)->Arg(8)->Arg(64)->Arg(512);
+
+static void BM_Sphere(benchmark::State& state) {
+  int slices = static_cast<int>(state.range(0));
+  buildFigure(state, [&](MeshSink& mesh) {
+    generateSpherePoints(1, slices, slices, mesh);
+  });
+}
+BENCHMARK(BM_Sphere)->Arg(16)->Arg(128)->Arg(1024);
+
+static void BM_Icosphere(benchmark::State& state) {
+  int subdivisions = static_cast<int>(state.range(0));
+  buildFigure(state, [&](MeshSink& mesh) {
+    generateIcosphere(1, subdivisions, mesh);
+  });
+}
+BENCHMARK(BM_Icosphere)->Arg(8)->Arg(32)->Arg(128);
+
+static void BM_CubeSphere(benchmark::State& state) {
+  int subdivisions = static_cast<int>(state.range(0));
+  buildFigure(state, [&](MeshSink& mesh) {
+    generateCubeSphere(1, subdivisions, mesh);
+  });
+}
+BENCHMARK(BM_CubeSphere)->Arg(8)->Arg(32)->Arg(128);
+
+static void BM_Cone(benchmark::State& state) {
+  size_t slices = static_cast<size_t>(state.range(0));
+  buildFigure(state, [&](MeshSink& mesh) {
+    coneTriangles(1, 2, slices, slices, mesh);
+  });
+}
+BENCHMARK(BM_Cone)->Arg(16)->Arg(128)->Arg(1024);
+
+static void BM_Cylinder(benchmark::State& state) {
+  int slices = static_cast<int>(state.range(0));
+  buildFigure(state,
+              [&](MeshSink& mesh) { calculateCylinder(1, 2, slices, mesh); });
+}
+BENCHMARK(BM_Cylinder)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void BM_Donut(benchmark::State& state) {
+  int sides = static_cast<int>(state.range(0));
+  buildFigure(state, [&](MeshSink& mesh) {
+    donutAllPoints(2, 0.5f, sides, sides, mesh);
+  });
+}
+BENCHMARK(BM_Donut)->Arg(16)->Arg(128)->Arg(1024);
+
+// Patches are tessellated on every core, so they are timed by the clock
+static void BM_Patch(benchmark::State& state) {
+  int level = static_cast<int>(state.range(0));
+  buildFigure(state, [&](MeshSink& mesh) {
+    tessellatePatches(teapot(), level, mesh);
+  });
+}
+BENCHMARK(BM_Patch)->Arg(10)->Arg(30)->Arg(100)->UseRealTime();
+
+// The argument is the maximum error as a power of ten: 2 is 0.01
+static void BM_AdaptivePatch(benchmark::State& state) {
+  float maxError = std::pow(10.0f, -static_cast<float>(state.range(0)));
+  buildFigure(state, [&](MeshSink& mesh) {
+    tessellatePatchesAdaptive(teapot(), maxError, mesh);
+  });
+}
+BENCHMARK(BM_AdaptivePatch)->DenseRange(2, 4)->UseRealTime();
@@ -0,0 +1,81 @@
+#ifndef FILEWRITER_HPP
+#define FILEWRITER_HPP
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * Text output to a file through one large buffer.
+ *
+ * Numbers are formatted with std::to_chars straight into the buffer, floats
+ * in the shortest form that reads back to the same value. Nothing is
+ * allocated per write, and the file is only written when the buffer fills,
+ * on seek() and on close().
+ */
+class FileWriter {
+ public:
+  static constexpr size_t BUFFER_SIZE = 1 << 20;
+
+  FileWriter();
+  explicit FileWriter(const std::string& path);
+  ~FileWriter();
+
+  FileWriter(const FileWriter&) = delete;
+  FileWriter& operator=(const FileWriter&) = delete;
+
+  bool open(const std::string& path);
+  bool isOpen() const { return _file != nullptr; }
+
+  FileWriter& operator<<(char c);
+  FileWriter& operator<<(std::string_view text);
+  FileWriter& operator<<(const char* text) {
+    return *this << std::string_view(text);
+  }
+
+  // Integers, and floats in their shortest round-trip form
+  template <typename T>
+    requires std::is_arithmetic_v<T>
+  FileWriter& operator<<(T value) {
+    if (BUFFER_SIZE - _size < MAX_NUMBER_LENGTH) {
+      flush();
+    }
+    _size += formatNumber(_buffer.get() + _size, value);
+    return *this;
+  }
+
+  // Moves to a byte offset, to overwrite what was written there
+  bool seek(long offset);
+
+  // Writes the rest of the buffer and closes the file
+  // @return False if any write failed
+  bool close();
+
+ private:
+  static constexpr size_t MAX_NUMBER_LENGTH = 32;
+
+  static size_t formatNumber(char* out, float value);
+  static size_t formatNumber(char* out, double value);
+  static size_t formatNumber(char* out, long long value);
+  static size_t formatNumber(char* out, unsigned long long value);
+  template <typename T>
+    requires std::is_integral_v<T>
+  static size_t formatNumber(char* out, T value) {
+    if constexpr (std::is_signed_v<T>) {
+      return formatNumber(out, static_cast<long long>(value));
+    } else {
+      return formatNumber(out, static_cast<unsigned long long>(value));
+    }
+  }
+
+  void flush();
+
+  std::FILE* _file = nullptr;
+  std::unique_ptr<char[]> _buffer;
+  size_t _size = 0;
+  bool _failed = false;
+};
+
+#endif  // FILEWRITER_HPP
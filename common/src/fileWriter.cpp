@@ -0,0 +1,85 @@
+#include "fileWriter.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+FileWriter::FileWriter() : _buffer(std::make_unique<char[]>(BUFFER_SIZE)) {}
+
+FileWriter::FileWriter(const std::string& path) : FileWriter() { open(path); }
+
+FileWriter::~FileWriter() { close(); }
+
+bool FileWriter::open(const std::string& path) {
+  close();
+  _file = std::fopen(path.c_str(), "wb");
+  _failed = _file == nullptr;
+  return _file != nullptr;
+}
+
+void FileWriter::flush() {
+  if (_size == 0) {
+    return;
+  }
+  if (!_file || std::fwrite(_buffer.get(), 1, _size, _file) != _size) {
+    _failed = true;
+  }
+  _size = 0;
+}
+
+FileWriter& FileWriter::operator<<(char c) {
+  if (_size == BUFFER_SIZE) {
+    flush();
+  }
+  _buffer[_size++] = c;
+  return *this;
+}
+
+FileWriter& FileWriter::operator<<(std::string_view text) {
+  while (!text.empty()) {
+    if (_size == BUFFER_SIZE) {
+      flush();
+    }
+    size_t count = std::min(text.size(), BUFFER_SIZE - _size);
+    std::memcpy(_buffer.get() + _size, text.data(), count);
+    _size += count;
+    text.remove_prefix(count);
+  }
+  return *this;
+}
+
+size_t FileWriter::formatNumber(char* out, float value) {
+  return std::to_chars(out, out + MAX_NUMBER_LENGTH, value).ptr - out;
+}
+
+size_t FileWriter::formatNumber(char* out, double value) {
+  return std::to_chars(out, out + MAX_NUMBER_LENGTH, value).ptr - out;
+}
+
+size_t FileWriter::formatNumber(char* out, long long value) {
+  return std::to_chars(out, out + MAX_NUMBER_LENGTH, value).ptr - out;
+}
+
+size_t FileWriter::formatNumber(char* out, unsigned long long value) {
+  return std::to_chars(out, out + MAX_NUMBER_LENGTH, value).ptr - out;
+}
+
+bool FileWriter::seek(long offset) {
+  flush();
+  if (!_file || std::fseek(_file, offset, SEEK_SET) != 0) {
+    _failed = true;
+  }
+  return !_failed;
+}
+
+bool FileWriter::close() {
+  if (!_file) {
+    return !_failed;
+  }
+  flush();
+  if (std::fclose(_file) != 0) {
+    _failed = true;
+  }
+  _file = nullptr;
+  return !_failed;
+}
@@ -8,6 +8,8 @@
 #include <string>
 #include <vector>
 
+#include "../include/fileWriter.hpp"
+
 #define DIR "models/"
 
 std::map<std::string, std::vector<Point>> hash_models;
@@ -85,13 +87,16 @@ void saveToFile(const std::vector<Point>& points, const char* filePath) {
   std::string fullPath(DIR);
   fullPath.append(filePath);
 
-  std::ofstream outputFile(fullPath);
+  FileWriter outputFile(fullPath);
 
-  if (outputFile.is_open()) {
+  if (outputFile.isOpen()) {
     for (const auto& point : points) {
-      outputFile << point.x << " " << point.y << " " << point.z << "\n";
+      outputFile << point.x << ' ' << point.y << ' ' << point.z << '\n';
+    }
+    if (!outputFile.close()) {
+      log("error", "Failed writing " + fullPath + ". Check the free space.");
+      return;
     }
-    outputFile.close();
     log("success", "File saved successfully at: " + fullPath);
   } else {
     log("error", "nable to open file for writing: " + fullPath +
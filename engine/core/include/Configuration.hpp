@@ -0,0 +1,35 @@
+#ifndef CONFIGURATION_HPP
+#define CONFIGURATION_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Camera.hpp"
+#include "Configuration.hpp"
+#include "ModelGroup.hpp"
+#include "Window.hpp"
+#include "sceneArena.hpp"
+
+class Configuration {
+ public:
+  // Backs the group tree; declared first so it is released last
+  std::shared_ptr<SceneArena> arena;
+  Window window;
+  Camera camera;
+  ModelGroup modelGroup;
+  std::vector<Light> lights;
+
+  Configuration() = default;
+  Configuration(const Window &window, const Camera &camera, ModelGroup group);
+  Configuration(const Window &window, const Camera &camera, ModelGroup group,
+                std::vector<Light> lights);
+  Configuration(Configuration &&other) = default;
+  Configuration &operator=(Configuration &&other);
+
+  bool addLight(const Light &light);
+  bool removeLight(int index);
+  // std::string toString();
+};
+
+#endif  // CONFIGURATION_HPP
\ No newline at end of file
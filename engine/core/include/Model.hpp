@@ -0,0 +1,59 @@
+#ifndef MODEL_HPP
+#define MODEL_HPP
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "aabb.hpp"
+#include "light.hpp"
+#include "utils.hpp"
+#include "vertexCords.hpp"
+
+// The distinct vertices of a triangle list, in order of first use
+std::vector<Vertex> createVertexBuffer(const std::vector<Vertex>& vertices);
+
+// The index in uniqueVertices of every vertex of a triangle list
+std::vector<unsigned int> createIndexBuffer(
+    const std::vector<Vertex>& vertices,
+    const std::vector<Vertex>& uniqueVertices);
+
+/**
+ * Welded geometry of a model file and the names of its GPU buffers.
+ *
+ * Every Model read from the same file shares one Mesh, so the vertex data
+ * exists once in memory and is uploaded once. The buffer names are only
+ * filled in by the renderer (initModel in renderer.hpp); the core never
+ * calls GL.
+ */
+struct Mesh {
+  std::vector<Vertex> vbo;
+  std::vector<unsigned int> ibo;
+  AABB bounds;  // Model-space bounds of the vertices
+  unsigned int vertex_buffer = 0, normal_buffer = 0, texture_buffer = 0,
+               index_buffer = 0;
+  bool uploaded = false;
+};
+
+class Model {
+ public:
+  std::string filename, texture_filepath;
+  std::shared_ptr<Mesh> mesh;
+  int id;
+  bool initialized = false;  // Mesh and texture handed to the renderer
+  Material material;
+  unsigned int texture_id = 0;  // Set by the renderer, 0 without texture
+
+  Model();
+  Model(std::string filename, std::vector<Vertex> points);
+  // Takes geometry that is already indexed, without welding it again
+  Model(std::string filename, std::vector<Vertex> vbo,
+        std::vector<unsigned int> ibo);
+
+  bool hasTexture() const { return texture_id != 0; }
+};
+
+#endif  // MODEL_HPP
\ No newline at end of file
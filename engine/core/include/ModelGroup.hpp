@@ -0,0 +1,53 @@
+#ifndef GROUP_HPP
+#define GROUP_HPP
+
+#include <array>  // Include for std::array
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "Model.hpp"
+#include "catmullCurves.hpp"
+#include "instanceSet.hpp"
+#include "utils.hpp"
+
+/**
+ * Node of the scene tree as described by the XML file.
+ *
+ * All containers use the allocator the group was created with, normally the
+ * scene arena, and pass it down to the subgroups and curves they hold.
+ */
+class ModelGroup {
+ public:
+  using allocator_type = std::pmr::polymorphic_allocator<>;
+
+  std::pmr::string name;  // From the optional name attribute
+  std::pmr::vector<Model> models;
+  std::pmr::vector<InstanceSet> instances;
+  std::pmr::vector<ModelGroup> subModelgroups;
+  std::pmr::vector<glm::mat4> static_transformations;
+
+  std::pmr::vector<TimeRotations> rotations;
+  std::pmr::vector<TimeTranslations> translates;
+  std::pmr::vector<Transformations> order;
+
+  ModelGroup() : ModelGroup(allocator_type()) {}
+  explicit ModelGroup(const allocator_type& alloc);
+  ModelGroup(const ModelGroup& other, const allocator_type& alloc = {});
+  ModelGroup(ModelGroup&& other) = default;
+  ModelGroup(ModelGroup&& other, const allocator_type& alloc);
+  ModelGroup& operator=(const ModelGroup& other) = default;
+  ModelGroup& operator=(ModelGroup&& other) = default;
+
+  allocator_type get_allocator() const { return models.get_allocator(); }
+
+  void translate(float x, float y, float z);
+
+  void scale(float x, float y, float z);
+
+  void rotate(float angle, float x, float y, float z);
+};
+
+#endif  // GROUP_HPP
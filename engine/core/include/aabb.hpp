@@ -0,0 +1,58 @@
+#ifndef AABB_HPP
+#define AABB_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <glm/glm.hpp>
+#include <limits>
+
+/**
+ * Axis-aligned bounding box. A default constructed box is empty (min above
+ * max), so growing it by any point or box gives that point or box.
+ */
+struct AABB {
+  glm::vec3 min = glm::vec3(std::numeric_limits<float>::infinity());
+  glm::vec3 max = glm::vec3(-std::numeric_limits<float>::infinity());
+
+  bool empty() const {
+    return min.x > max.x || min.y > max.y || min.z > max.z;
+  }
+
+  glm::vec3 center() const { return (min + max) * 0.5f; }
+  glm::vec3 extent() const { return (max - min) * 0.5f; }
+
+  void grow(const glm::vec3& point) {
+    min = glm::min(min, point);
+    max = glm::max(max, point);
+  }
+
+  void grow(const AABB& box) {
+    min = glm::min(min, box.min);
+    max = glm::max(max, box.max);
+  }
+
+  // Squared distance from a point to the box (0 inside)
+  float distance2(const glm::vec3& point) const {
+    glm::vec3 d = glm::max(glm::max(min - point, point - max), glm::vec3(0));
+    return glm::dot(d, d);
+  }
+
+  /**
+   * Bounds of this box after an affine transform. Transforms the center and
+   * folds the absolute values of the matrix into the half extents, which is
+   * exact for the box and much cheaper than transforming its 8 corners.
+   */
+  AABB transformed(const glm::mat4& matrix) const {
+    if (empty()) return AABB();
+
+    glm::vec3 c = glm::vec3(matrix * glm::vec4(center(), 1.0f));
+    glm::vec3 e = extent();
+    glm::vec3 r(0.0f);
+    for (int col = 0; col < 3; col++) {
+      r += glm::abs(glm::vec3(matrix[col])) * e[col];
+    }
+    return {c - r, c + r};
+  }
+};
+
+#endif  // AABB_HPP
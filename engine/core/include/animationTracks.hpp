@@ -0,0 +1,58 @@
+#ifndef ANIMATIONTRACKS_HPP
+#define ANIMATIONTRACKS_HPP
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "catmullCurves.hpp"
+
+/**
+ * Timed rotations and translations of a scene, evaluated in batches.
+ *
+ * Every track is stored structure-of-arrays, so one pass of the kernels
+ * evaluates simd::WIDTH tracks at once: the axis-angle rotation matrix of a
+ * TimeRotations, and the curve position, tangent and aligned frame of a
+ * TimeTranslations. The Catmull-Rom coefficients of all curves are packed in
+ * one set of arrays and gathered per lane by segment.
+ *
+ * Curves that move at constant speed still invert their arc length table
+ * one lane at a time before the vector part runs.
+ */
+class AnimationTracks {
+ public:
+  // The translations must outlive the tracks (constant speed lookups)
+  void build(const std::vector<TimeRotations>& rotations,
+             const std::vector<TimeTranslations>& translations);
+  void clear();
+
+  size_t rotationCount() const { return _rotationCount; }
+  size_t translationCount() const { return _translationCount; }
+
+  // Writes the matrices of the tracks [begin, end) to out[begin, end)
+  void evaluateRotations(float elapsed_time, size_t begin, size_t end,
+                         glm::mat4* out) const;
+  void evaluateTranslations(float elapsed_time, size_t begin, size_t end,
+                            glm::mat4* out) const;
+
+ private:
+  size_t _rotationCount = 0;
+  size_t _translationCount = 0;
+
+  // Rotation tracks: seconds per turn (infinite when disabled) and unit axis
+  std::vector<float> _rotationPeriod;
+  std::vector<float> _axisX, _axisY, _axisZ;
+
+  // Translation tracks: seconds per loop, segment range and frame options
+  std::vector<float> _translationPeriod;
+  std::vector<float> _segmentOffset, _segmentCount;
+  std::vector<float> _align;  // 1 to orient along the curve
+  std::vector<float> _upX, _upY, _upZ;
+  std::vector<uint8_t> _constantSpeed;
+  const std::vector<TimeTranslations>* _curves = nullptr;
+
+  // Coefficients a, b, c, d of every segment, one array per component
+  std::vector<float> _coefficients[12];
+};
+
+#endif  // ANIMATIONTRACKS_HPP
@@ -0,0 +1,135 @@
+#ifndef BVH_HPP
+#define BVH_HPP
+
+#include <glm/glm.hpp>
+#include <utility>
+#include <vector>
+
+#include "aabb.hpp"
+#include "sceneGraph.hpp"
+
+/**
+ * View frustum as six inward-facing planes (xyz = normal, w = distance),
+ * extracted from a projection * view matrix.
+ */
+struct Frustum {
+  glm::vec4 planes[6];
+
+  explicit Frustum(const glm::mat4& viewProjection);
+
+  // False only if the box is entirely outside one of the planes
+  bool intersects(const AABB& box) const;
+};
+
+/**
+ * Bounding volume hierarchy over the world-space bounds of every model
+ * instance of a SceneGraph.
+ *
+ * Instances are split into two trees. Those with no timed transform on
+ * their node or any ancestor never move, so their tree is built once;
+ * everything else goes into a second tree whose topology is also built
+ * once but whose bounds are refit bottom-up after every scene update. The
+ * copies in the graph's instance sets orbit their group, so they always go
+ * into the second tree.
+ *
+ * Queries return items: the indices into SceneGraph::models come first,
+ * followed by the instances of every set, one item each (instance()).
+ */
+class BVH {
+ public:
+  // Position of an item past the models within SceneGraph::instance_sets
+  struct InstanceRef {
+    int set;
+    int instance;
+  };
+
+  // Builds both trees from the graph's current world matrices
+  void build(const SceneGraph& graph);
+
+  // Recomputes the bounds of the moving instances and their tree
+  void refit(const SceneGraph& graph);
+
+  void clear();
+  bool built() const { return _built; }
+
+  // Instances whose bounds intersect the frustum
+  void queryFrustum(const Frustum& frustum, std::vector<int>& out) const;
+
+  /**
+   * The same, with the items split by kind
+   *
+   * @param models Indices into SceneGraph::models
+   * @param instances Per instance set, the indices of its visible instances
+   *        in ascending order
+   */
+  void queryFrustum(const Frustum& frustum, std::vector<int>& models,
+                    std::vector<std::vector<int>>& instances) const;
+
+  // Instances whose bounds intersect the sphere
+  void querySphere(const glm::vec3& center, float radius,
+                   std::vector<int>& out) const;
+
+  /**
+   * Instances whose bounds the ray hits, as (entry distance, item) pairs
+   * sorted front to back
+   *
+   * @param direction Ray direction; distances are in multiples of it
+   */
+  void queryRay(const glm::vec3& origin, const glm::vec3& direction,
+                std::vector<std::pair<float, int>>& out) const;
+
+  // The k instances whose bounds are closest to the point, nearest first
+  void queryNearest(const glm::vec3& point, size_t k,
+                    std::vector<int>& out) const;
+
+  const AABB& bounds(int item) const { return _bounds[item]; }
+
+  bool isInstance(int item) const {
+    return static_cast<size_t>(item) >= _modelCount;
+  }
+  InstanceRef instance(int item) const {
+    return _instances[item - _modelCount];
+  }
+  int instanceItem(int set, int instance) const {
+    return _setFirst[set] + instance;
+  }
+
+  size_t nodeCount() const {
+    return _static.nodes.size() + _dynamic.nodes.size();
+  }
+  size_t staticCount() const { return _static.items.size(); }
+  size_t dynamicCount() const { return _dynamic.items.size(); }
+
+  double buildMs() const { return _buildMs; }  // Last build
+  double refitMs() const { return _refitMs; }  // Last refit
+
+ private:
+  struct Node {
+    AABB box;
+    int first;  // Left child for inner nodes, first item for leaves
+    int count;  // Items in a leaf, 0 for inner nodes (right = first + 1)
+  };
+
+  struct Tree {
+    std::vector<Node> nodes;  // Children always follow their parent
+    std::vector<int> items;   // Items, grouped by leaf
+  };
+
+  void buildTree(Tree& tree);
+  void split(Tree& tree, int node, int begin, int end);
+  void refitTree(Tree& tree);
+  void updateBounds(const SceneGraph& graph, const std::vector<int>& items);
+
+  template <typename Overlaps, typename Visit>
+  void traverse(const Tree& tree, Overlaps overlaps, Visit visit) const;
+
+  std::vector<AABB> _bounds;  // World bounds, by item
+  size_t _modelCount = 0;
+  std::vector<InstanceRef> _instances;  // By item past the models
+  std::vector<int> _setFirst;           // First item of each instance set
+  Tree _static, _dynamic;
+  bool _built = false;
+  double _buildMs = 0.0, _refitMs = 0.0;
+};
+
+#endif  // BVH_HPP
@@ -0,0 +1,84 @@
+#ifndef CATMULLCURVES_HPP
+#define CATMULLCURVES_HPP
+
+#include <array>  // Include for std::array
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "Model.hpp"
+#include "utils.hpp"
+
+enum Transformations { TIMEROTATION, TIMETRANSLATE, STATIC };
+
+class TimeRotations {
+ public:
+  float time;
+  float x;
+  float y;
+  float z;
+
+  TimeRotations();
+  TimeRotations(float time, float x, float y, float z);
+
+  glm::mat4 applyTimeRotation(float elapsed_time);
+};
+
+/**
+ * Polynomial form of one Catmull-Rom segment: p(t) = ((a*t + b)*t + c)*t + d
+ */
+struct CurveSegment {
+  Point a, b, c, d;
+};
+
+class TimeTranslations {
+ public:
+  using allocator_type = std::pmr::polymorphic_allocator<>;
+
+  float time;
+  bool align;
+  bool constant_speed;
+  std::pmr::vector<Point> curvePoints;
+  Point y_axis;
+
+  // Coefficients of every segment, computed once from the control points
+  std::pmr::vector<CurveSegment> segments;
+  // Cumulative arc length at ARC_SAMPLES uniform steps per segment, used to
+  // move at constant speed when constant_speed is set
+  std::pmr::vector<float> arcLengths;
+  static const int ARC_SAMPLES = 64;
+
+  TimeTranslations() : TimeTranslations(allocator_type()) {}
+  explicit TimeTranslations(const allocator_type& alloc);
+  TimeTranslations(float time, bool align, std::pmr::vector<Point> curve,
+                   bool constant_speed = false,
+                   const allocator_type& alloc = {});
+  TimeTranslations(const TimeTranslations& other,
+                   const allocator_type& alloc = {});
+  TimeTranslations(TimeTranslations&& other) = default;
+  TimeTranslations(TimeTranslations&& other, const allocator_type& alloc);
+  TimeTranslations& operator=(const TimeTranslations& other) = default;
+  TimeTranslations& operator=(TimeTranslations&& other) = default;
+
+  glm::mat4 applyTimeTranslations(float elapsed_time);
+
+  // Curve parameter, in segments, reached at a fraction of the loop
+  float curveParameter(float fraction) const;
+
+  // Position and tangent at a fraction of the loop, in [0, 1)
+  std::pair<Point, Point> evaluate(float fraction) const;
+
+  std::pair<Point, Point> getLocation(float elapsed_time);
+
+  std::array<float, 16> rotationMatrix(Point x, Point y, Point z);
+};
+
+// Reference evaluation that recomputes the basis product on every call
+std::pair<Point, Point> catmollRomPosition(std::vector<Point> curve,
+                                           float global_time);
+
+glm::mat4 Scalematrix(float x, float y, float z);
+glm::mat4 Rotationmatrix(float angle, float x, float y, float z);
+glm::mat4 Translatematrix(float x, float y, float z);
+
+#endif  // CURVES_HPP
\ No newline at end of file
@@ -0,0 +1,42 @@
+#ifndef FILEPARSER_HPP
+#define FILEPARSER_HPP
+
+#include <string>
+#include <vector>
+
+#include "Configuration.hpp"
+#include "catmullCurves.hpp"
+#include "jobSystem.hpp"
+#include "xmlReader.hpp"
+
+// The model and texture files of an XML scene are read on jobs, or on a
+// temporary pool if it is null
+Configuration parseSceneFile(std::string filename, JobSystem* jobs = nullptr);
+
+Configuration parseConfig(std::string filename, JobSystem* jobs = nullptr);
+
+Configuration parseConfig3D(std::string filename);
+
+Configuration parseConfigObj(std::string filename);
+
+/**
+ * The functions below read the element the reader is on, with all of its
+ * children, into their output. On malformed input they return false and the
+ * reader holds the error.
+ */
+bool parseWorld(XmlReader& reader, Window& window, Camera& camera,
+                std::vector<Light>& lights, ModelGroup& sceneGroup);
+
+bool parseCamera(XmlReader& reader, Camera& camera);
+
+bool parseLights(XmlReader& reader, std::vector<Light>& lights);
+
+bool parseGroup(XmlReader& reader, ModelGroup& modelGroup);
+
+bool parseTransform(XmlReader& reader, ModelGroup& modelGroup);
+
+bool parseModels(XmlReader& reader, ModelGroup& modelGroup);
+
+bool parseInstances(XmlReader& reader, ModelGroup& modelGroup);
+
+#endif
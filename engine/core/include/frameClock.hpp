@@ -0,0 +1,52 @@
+#ifndef FRAMECLOCK_HPP
+#define FRAMECLOCK_HPP
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * Engine clock sampled once per frame.
+ *
+ * Real time is read from the wall clock in tick() and accumulated into the
+ * animation time, which is what every transform of the frame is evaluated
+ * at. The animation time can be paused, scaled, advanced with a fixed step
+ * (deterministic playback) or moved directly to a given time.
+ */
+class FrameClock {
+ public:
+  FrameClock();
+
+  // Advances the clock; call exactly once at the start of every frame
+  void tick();
+
+  // Animation time in seconds
+  double time() const { return _time; }
+  // Real seconds elapsed between the last two ticks (not scaled or paused)
+  float delta() const { return _delta; }
+  uint64_t frame() const { return _frame; }
+
+  void setPaused(bool paused) { _paused = paused; }
+  bool isPaused() const { return _paused; }
+
+  void setScale(float scale) { _scale = scale; }
+  float scale() const { return _scale; }
+
+  // Advance the animation by a fixed step per tick instead of real time
+  // (0 disables it)
+  void setFixedStep(double step) { _fixedStep = step; }
+  double fixedStep() const { return _fixedStep; }
+
+  // Jump the animation to the given time
+  void scrubTo(double time) { _time = time; }
+
+ private:
+  std::chrono::steady_clock::time_point _last;
+  double _time = 0.0;
+  float _delta = 0.0f;
+  float _scale = 1.0f;
+  double _fixedStep = 0.0;
+  bool _paused = false;
+  uint64_t _frame = 0;
+};
+
+#endif  // FRAMECLOCK_HPP
@@ -0,0 +1,57 @@
+#ifndef FRAMEPACKET_HPP
+#define FRAMEPACKET_HPP
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "Camera.hpp"
+#include "aabb.hpp"
+#include "picking.hpp"
+#include "sceneGraph.hpp"
+
+/**
+ * Everything the renderer reads about one simulated frame.
+ *
+ * The simulation fills a packet after updating the scene, and the renderer
+ * draws it while the next frame is simulated. The structure of the scene
+ * graph (its nodes, models and instance sets) doesn't change while a scene
+ * runs, so a packet only copies what does: the camera, the world matrices
+ * and the instance matrices, plus the results of culling and picking.
+ */
+struct FramePacket {
+  uint64_t frame = 0;  // Simulation step that produced it, from 1
+  double time = 0.0;   // Animation time the matrices were evaluated at
+
+  Camera camera;
+  glm::mat4 projection = glm::mat4(1.0f), view = glm::mat4(1.0f);
+
+  std::vector<glm::mat4> world;                   // Per scene graph node
+  std::vector<std::vector<glm::mat4>> instances;  // Per instance set
+
+  // When culled, only the models in visible are drawn, and instances holds
+  // only the matrices of the instances in visible_instances
+  bool culled = false;
+  std::vector<int> visible;  // Indices into SceneGraph::models
+  // Per instance set, indices of its instances
+  std::vector<std::vector<int>> visible_instances;
+
+  PickResult selection;             // Model or instance last clicked on
+  AABB selection_bounds;            // Its world bounds
+  glm::mat4 selection_world{1.0f};  // Its world matrix
+  double pick_ms = 0.0;             // Time the last pick took
+
+  int matrices_recomputed = 0;
+  size_t bvh_nodes = 0;
+  double bvh_build_ms = 0.0, bvh_refit_ms = 0.0;
+};
+
+// Copies the world and instance matrices of the graph, updated to the given
+// animation time, into the packet, reusing its storage
+void captureFrame(const SceneGraph& graph, double time, FramePacket& packet);
+
+// Keeps only the captured models and instances whose bounds intersect the
+// frustum, as of the BVH's last build or refit
+void cullFrame(const BVH& bvh, const Frustum& frustum, FramePacket& packet);
+
+#endif  // FRAMEPACKET_HPP
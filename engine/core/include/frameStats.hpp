@@ -0,0 +1,13 @@
+#ifndef FRAMESTATS_HPP
+#define FRAMESTATS_HPP
+
+/**
+ * Counters gathered while drawing a single frame
+ */
+struct FrameStats {
+  int draw_calls = 0;           // Number of glDrawElements calls issued
+  long triangles = 0;           // Number of triangles submitted
+  int matrices_recomputed = 0;  // World matrices recomputed by the update
+};
+
+#endif  // FRAMESTATS_HPP
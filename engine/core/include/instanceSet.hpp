@@ -0,0 +1,67 @@
+#ifndef INSTANCESET_HPP
+#define INSTANCESET_HPP
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "Model.hpp"
+
+/**
+ * Parameters of an <instances> element. Every range is sampled uniformly.
+ */
+struct InstanceDistribution {
+  int count = 0;
+  unsigned seed = 0;
+  float radiusMin = 1.0f, radiusMax = 1.0f;  // Orbit radius
+  float height = 0.0f;                       // Spread above/below the plane
+  float scaleMin = 1.0f, scaleMax = 1.0f;
+  float periodMin = 0.0f, periodMax = 0.0f;  // Seconds per orbit, 0 = fixed
+  bool randomRotation = false;               // Random fixed orientation
+};
+
+/**
+ * Copies of one model scattered around their group's origin.
+ *
+ * Each instance sits on a circle in the group's XZ plane, at a random
+ * radius, height and starting angle, and travels along it with its own
+ * period. Instead of a scene node per copy, the set keeps the sampled
+ * parameters in flat arrays and computes every instance matrix in one pass
+ * per frame. The renderer draws them with a single instanced draw call
+ * (instanceRenderer.hpp).
+ */
+class InstanceSet {
+ public:
+  Model model;  // Mesh, material and texture shared by every instance
+
+  // Buffer the renderer keeps the matrices in, and the frame packet they
+  // came from (0 before the first upload). Only the renderer touches them
+  unsigned int instance_buffer = 0;
+  uint64_t uploaded_frame = 0;
+
+  InstanceSet() = default;
+  InstanceSet(Model model, const InstanceDistribution& distribution);
+
+  size_t size() const { return _shape.size(); }
+
+  // Instance matrices relative to the group, valid after update()
+  const std::vector<glm::mat4>& matrices() const { return _matrices; }
+
+  // Moves every instance to its place at the given animation time
+  void update(double elapsed_time);
+
+ private:
+  // Per-instance parameters, padded to a multiple of the SIMD width. The
+  // starting angle is in turns, and the speed in turns per second, in
+  // double so that long run times keep the orbits exact
+  std::vector<float> _radius, _height, _phase;
+  std::vector<double> _turnRate;
+  // Orientation and scale of each instance
+  std::vector<glm::mat4> _shape;
+  std::vector<glm::mat4> _matrices;
+
+  bool _valid = false;
+  double _time = 0.0;
+};
+
+#endif  // INSTANCESET_HPP
@@ -0,0 +1,63 @@
+#ifndef JOBSYSTEM_HPP
+#define JOBSYSTEM_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Work-stealing thread pool.
+ *
+ * Every worker owns a task deque: it pops work from the back of its own deque
+ * and, when that is empty, steals from the front of the others. The thread
+ * that submits work takes part in executing it until it is done.
+ */
+class JobSystem {
+ public:
+  // 0 threads selects one worker per hardware thread (minus the caller)
+  explicit JobSystem(unsigned threads = 0);
+  JobSystem(const JobSystem&) = delete;
+  JobSystem& operator=(const JobSystem&) = delete;
+  ~JobSystem();
+
+  // Calls fn(begin, end) over [0, count) in chunks of at most grain items
+  // and returns once every chunk has run
+  void parallelFor(size_t count, size_t grain,
+                   const std::function<void(size_t, size_t)>& fn);
+
+  // Number of threads that execute work, including the caller
+  unsigned threadCount() const { return _threads.size() + 1; }
+
+ private:
+  struct Task {
+    const std::function<void(size_t, size_t)>* fn;
+    size_t begin, end;
+    std::atomic<size_t>* remaining;
+  };
+
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  void workerLoop(size_t self);
+  bool popTask(size_t self, Task& task);
+  void execute(Task& task);
+
+  // Queue 0 belongs to the submitting thread, queue i to worker i
+  std::vector<std::unique_ptr<Queue>> _queues;
+  std::vector<std::thread> _threads;
+
+  std::mutex _sleepMutex;
+  std::condition_variable _wake;
+  std::atomic<size_t> _pending{0};
+  bool _stop = false;
+};
+
+#endif  // JOBSYSTEM_HPP
@@ -1,16 +1,7 @@
 #ifndef LIGHT_HPP
 #define LIGHT_HPP
 
-extern "C" {
-#include <GL/gl.h>
-#ifdef __APPLE_CC__
-#include <GLUT/glut.h>
-#else
-#include <GL/freeglut.h>
-#endif
-}
 #include <glm/glm.hpp>
-#include <glm/gtc/type_ptr.hpp>
 #include <vector>
 
 enum LightType { DIRECTIONAL, POINT, SPOT };
@@ -28,10 +19,6 @@ Light createPointLight(glm::vec4 position);
 
 Light createSpotLight(glm::vec4 position, glm::vec4 direction, float cutoff);
 
-bool setupLights(std::vector<Light> lights);
-
-void drawLights(std::vector<Light> lights);
-
 struct Material {
   glm::vec4 ambient;
   glm::vec4 diffuse;
@@ -44,6 +31,4 @@ Material createMaterial(glm::vec4 ambient, glm::vec4 diffuse,
                         glm::vec4 specular, glm::vec4 emission,
                         float shininess);
 
-void setupMaterial(Material m);
-
 #endif  // LIGHT_HPP
\ No newline at end of file
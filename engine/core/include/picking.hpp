@@ -0,0 +1,56 @@
+#ifndef PICKING_HPP
+#define PICKING_HPP
+
+#include <glm/glm.hpp>
+
+#include "Model.hpp"
+#include "bvh.hpp"
+#include "sceneGraph.hpp"
+
+struct Ray {
+  glm::vec3 origin;
+  glm::vec3 direction;  // Hit distances are in multiples of it
+};
+
+/**
+ * Nearest surface under a ray
+ */
+struct PickResult {
+  int model = -1;  // Index into SceneGraph::models, -1 if no model was hit
+  int set = -1;    // Index into SceneGraph::instance_sets for an instance
+  int instance = -1;
+  int triangle = -1;
+  float distance = 0.0f;
+
+  bool hit() const { return model >= 0 || set >= 0; }
+};
+
+/**
+ * Ray from the near plane through a cursor position
+ *
+ * @param cursor Window coordinates, origin at the top left
+ * @param viewport Window size in pixels
+ */
+Ray cursorRay(const glm::mat4& viewProjection, glm::vec2 cursor,
+              glm::vec2 viewport);
+
+/**
+ * Closest intersection of a model-space ray with the mesh triangles, tested
+ * simd::WIDTH triangles at a time with the Moller-Trumbore algorithm.
+ *
+ * @param distance In: hits at or beyond it are ignored. Out: the hit distance
+ * @return Index of the triangle hit, or -1
+ */
+int intersectMesh(const Mesh& mesh, const Ray& ray, float& distance);
+
+/**
+ * Model or instance whose surface the ray hits first. The BVH narrows them
+ * down to those whose bounds the ray crosses, visited front to back, and
+ * the search stops once the next bounds start beyond the closest hit.
+ */
+PickResult pick(const SceneGraph& graph, const BVH& bvh, const Ray& ray);
+
+// World matrix of what was picked, or the identity if nothing was
+glm::mat4 pickedWorld(const SceneGraph& graph, const PickResult& result);
+
+#endif  // PICKING_HPP
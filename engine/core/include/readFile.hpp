@@ -0,0 +1,70 @@
+#ifndef READFILE_HPP
+#define READFILE_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Model.hpp"
+#include "utils.hpp"
+
+class JobSystem;
+
+Model readFile(const char* filepath);
+
+// The readers of each format, which don't use the cache of readFile
+Model readOBJfile(const char* filepath);
+Model read3DFile(const char* filepath);
+Model read3DAdvancedFile(const char* filepath);
+
+/**
+ * Builds a figure of the shapes library in memory, or returns the model an
+ * earlier call built with the same parameters. A patch file is found like
+ * a model file.
+ *
+ * @param values The figure's parameters, see shapeParameters
+ * @return The model, with id -1 if the parameters are invalid
+ */
+Model buildProceduralModel(const std::string& shape,
+                           const std::vector<std::string>& values);
+
+/**
+ * Texture file decoded to 8-bit RGBA
+ */
+struct TextureImage {
+  int width = 0, height = 0;
+  unsigned char* pixels = nullptr;  // Owned, freed with stbi_image_free
+
+  TextureImage() = default;
+  TextureImage(const TextureImage&) = delete;
+  TextureImage& operator=(const TextureImage&) = delete;
+  ~TextureImage();
+};
+
+/**
+ * Decodes a texture file, or returns the image an earlier call decoded
+ *
+ * @return The image, or null if the file can't be read
+ */
+std::shared_ptr<const TextureImage> readTexture(const std::string& filepath);
+
+/**
+ * Frees the decoded textures, once they have been uploaded
+ */
+void releaseTextures();
+
+/**
+ * Forgets the models read so far, so that readFile reads their files again.
+ * Models already returned keep their meshes.
+ */
+void releaseModels();
+
+/**
+ * Reads model and texture files into the caches of readFile and
+ * readTexture, one file per job, so that the whole set takes about as long
+ * as its slowest file. Duplicates and files already read are skipped.
+ */
+void preloadFiles(const std::vector<std::string>& models,
+                  const std::vector<std::string>& textures, JobSystem& jobs);
+
+#endif  // READ_HPP
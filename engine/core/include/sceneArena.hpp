@@ -0,0 +1,49 @@
+#ifndef SCENEARENA_HPP
+#define SCENEARENA_HPP
+
+#include <cstddef>
+#include <memory_resource>
+
+/**
+ * Monotonic memory for everything that lives as long as a scene.
+ *
+ * Scene containers (group vectors, curve points and tables) allocate from
+ * the arena through std::pmr allocators. Deallocation is a no-op: the heap
+ * blocks are released together when the arena is destroyed, so tearing a
+ * scene down costs one pass over the blocks instead of one free per
+ * container. Not thread-safe; scenes are parsed on one thread.
+ */
+class SceneArena : public std::pmr::memory_resource {
+ public:
+  SceneArena();
+  SceneArena(const SceneArena&) = delete;
+  SceneArena& operator=(const SceneArena&) = delete;
+
+  size_t allocations() const { return _allocations; }  // Requests served
+  size_t bytesRequested() const { return _bytesRequested; }
+  size_t blocks() const { return _upstream.blocks; }  // Heap allocations
+  // The arena never shrinks, so what it took from the heap is its peak
+  size_t bytesReserved() const { return _upstream.bytes; }
+
+ private:
+  // Counts the blocks the arena takes from the heap
+  struct Upstream : std::pmr::memory_resource {
+    size_t blocks = 0;
+    size_t bytes = 0;
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const memory_resource& other) const noexcept override;
+  };
+
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+  Upstream _upstream;
+  std::pmr::monotonic_buffer_resource _pool;
+  size_t _allocations = 0;
+  size_t _bytesRequested = 0;
+};
+
+#endif  // SCENEARENA_HPP
@@ -0,0 +1,96 @@
+#ifndef SCENEGRAPH_HPP
+#define SCENEGRAPH_HPP
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "ModelGroup.hpp"
+#include "animationTracks.hpp"
+#include "catmullCurves.hpp"
+#include "frameStats.hpp"
+#include "jobSystem.hpp"
+
+/**
+ * Flattened form of a ModelGroup hierarchy.
+ *
+ * Nodes are stored breadth-first, so every parent comes before its children
+ * and the world matrices can be computed in one linear pass. Per-node data
+ * lives in parallel arrays indexed by node; transform steps are ranges into
+ * the op arrays, which in turn index the contiguous static matrix, rotation
+ * and translation arrays.
+ *
+ * Local and world matrices are cached per node. Only nodes with a timed
+ * rotation or translation recompute their local matrix, and a world matrix
+ * is only recomposed when the node's local matrix or its parent's world
+ * matrix changed, so fully static subtrees are transformed once.
+ *
+ * Since the nodes of one depth level only depend on the previous level, each
+ * level is evaluated in parallel when a job system is attached. The timed
+ * transforms themselves are evaluated beforehand, all at once, by the SIMD
+ * kernels of AnimationTracks.
+ */
+class SceneGraph {
+ public:
+  // Per-node arrays
+  std::vector<int> parent;  // -1 for the root
+  std::vector<int> op_begin, op_count;
+  std::vector<int> model_begin, model_count;
+  std::vector<glm::mat4> local;           // Cached local matrices
+  std::vector<glm::mat4> world;           // Filled by update()
+  std::vector<uint8_t> animated;          // Node has a timed transform step
+  std::vector<const ModelGroup*> groups;  // Group the node was built from
+
+  // Nodes of depth d are [level_begin[d], level_begin[d + 1])
+  std::vector<int> level_begin;
+
+  // Transform steps, in application order
+  std::vector<Transformations> op_type;
+  std::vector<int> op_index;  // Index into the array matching op_type
+
+  // Transform data
+  std::vector<glm::mat4> static_matrices;
+  std::vector<TimeRotations> rotations;
+  std::vector<TimeTranslations> translations;
+
+  // Matrices of the timed steps at the current time, filled by tracks
+  AnimationTracks tracks;
+  std::vector<glm::mat4> rotation_matrices;
+  std::vector<glm::mat4> translation_matrices;
+
+  // Models are owned by the ModelGroup tree the graph was built from
+  std::vector<Model*> models;
+  std::vector<int> model_node;  // Node each model belongs to
+
+  // Instance sets, placed by the world matrix of their node
+  std::vector<InstanceSet*> instance_sets;
+  std::vector<int> instance_node;
+
+  void build(ModelGroup& root);
+  void clear();
+
+  // Recomputes the world matrices that changed at the given animation time.
+  // Kept in double down to the instance sets, which wrap their orbits
+  // before narrowing it
+  void update(double elapsed_time, FrameStats& stats);
+
+  // Evaluates levels on the given job system (nullptr for the caller only)
+  void setJobSystem(JobSystem* jobs) { _jobs = jobs; }
+
+  // Forces every matrix to be recomputed on the next update
+  void invalidate() { _valid = false; }
+
+  size_t size() const { return parent.size(); }
+
+ private:
+  glm::mat4 localMatrix(int node);
+  int updateRange(size_t begin, size_t end, bool timeChanged);
+  void updateTracks(float elapsed_time);
+
+  std::vector<uint8_t> _changed;  // World matrix changed this update
+  bool _valid = false;
+  double _time = 0.0;
+  JobSystem* _jobs = nullptr;
+};
+
+#endif  // SCENEGRAPH_HPP
@@ -0,0 +1,241 @@
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+#include <cmath>
+
+#if defined(__AVX512F__) || defined(__AVX2__) || defined(__SSE2__) || \
+    defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+/**
+ * Minimal float vector wrappers for the batched animation kernels.
+ *
+ * Float holds WIDTH lanes and Mask the result of a lane comparison. The
+ * width is chosen at compile time from the widest instruction set enabled:
+ * AVX-512 (16 lanes), AVX2 (8), SSE2 (4) or a scalar fallback (1). Building
+ * with ENGINE_NATIVE_SIMD enables whatever the host CPU supports.
+ */
+namespace simd {
+
+#if defined(__AVX512F__)
+
+constexpr int WIDTH = 16;
+
+struct Float {
+  __m512 v;
+};
+struct Mask {
+  __mmask16 v;
+};
+
+inline Float broadcast(float x) { return {_mm512_set1_ps(x)}; }
+inline Float load(const float* p) { return {_mm512_loadu_ps(p)}; }
+inline void store(float* p, Float a) { _mm512_storeu_ps(p, a.v); }
+inline Float gather(const float* base, Float index) {
+  return {_mm512_i32gather_ps(_mm512_cvttps_epi32(index.v), base, 4)};
+}
+
+inline Float operator+(Float a, Float b) { return {_mm512_add_ps(a.v, b.v)}; }
+inline Float operator-(Float a, Float b) { return {_mm512_sub_ps(a.v, b.v)}; }
+inline Float operator*(Float a, Float b) { return {_mm512_mul_ps(a.v, b.v)}; }
+inline Float operator/(Float a, Float b) { return {_mm512_div_ps(a.v, b.v)}; }
+inline Float fmadd(Float a, Float b, Float c) {
+  return {_mm512_fmadd_ps(a.v, b.v, c.v)};
+}
+inline Float floor(Float a) {
+  return {_mm512_roundscale_ps(a.v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)};
+}
+inline Float sqrt(Float a) { return {_mm512_sqrt_ps(a.v)}; }
+inline Float min(Float a, Float b) { return {_mm512_min_ps(a.v, b.v)}; }
+
+inline Mask operator<(Float a, Float b) {
+  return {_mm512_cmp_ps_mask(a.v, b.v, _CMP_LT_OQ)};
+}
+inline Mask operator>(Float a, Float b) {
+  return {_mm512_cmp_ps_mask(a.v, b.v, _CMP_GT_OQ)};
+}
+inline Mask operator&(Mask a, Mask b) {
+  return {static_cast<__mmask16>(a.v & b.v)};
+}
+// Lanes of a where the mask is set, lanes of b elsewhere
+inline Float select(Mask m, Float a, Float b) {
+  return {_mm512_mask_blend_ps(m.v, b.v, a.v)};
+}
+
+#elif defined(__AVX2__)
+
+constexpr int WIDTH = 8;
+
+struct Float {
+  __m256 v;
+};
+struct Mask {
+  __m256 v;
+};
+
+inline Float broadcast(float x) { return {_mm256_set1_ps(x)}; }
+inline Float load(const float* p) { return {_mm256_loadu_ps(p)}; }
+inline void store(float* p, Float a) { _mm256_storeu_ps(p, a.v); }
+inline Float gather(const float* base, Float index) {
+  return {_mm256_i32gather_ps(base, _mm256_cvttps_epi32(index.v), 4)};
+}
+
+inline Float operator+(Float a, Float b) { return {_mm256_add_ps(a.v, b.v)}; }
+inline Float operator-(Float a, Float b) { return {_mm256_sub_ps(a.v, b.v)}; }
+inline Float operator*(Float a, Float b) { return {_mm256_mul_ps(a.v, b.v)}; }
+inline Float operator/(Float a, Float b) { return {_mm256_div_ps(a.v, b.v)}; }
+inline Float fmadd(Float a, Float b, Float c) {
+#ifdef __FMA__
+  return {_mm256_fmadd_ps(a.v, b.v, c.v)};
+#else
+  return {_mm256_add_ps(_mm256_mul_ps(a.v, b.v), c.v)};
+#endif
+}
+inline Float floor(Float a) { return {_mm256_floor_ps(a.v)}; }
+inline Float sqrt(Float a) { return {_mm256_sqrt_ps(a.v)}; }
+inline Float min(Float a, Float b) { return {_mm256_min_ps(a.v, b.v)}; }
+
+inline Mask operator<(Float a, Float b) {
+  return {_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)};
+}
+inline Mask operator>(Float a, Float b) {
+  return {_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ)};
+}
+inline Mask operator&(Mask a, Mask b) { return {_mm256_and_ps(a.v, b.v)}; }
+// Lanes of a where the mask is set, lanes of b elsewhere
+inline Float select(Mask m, Float a, Float b) {
+  return {_mm256_blendv_ps(b.v, a.v, m.v)};
+}
+
+#elif defined(__SSE2__) || defined(_M_X64)
+
+constexpr int WIDTH = 4;
+
+struct Float {
+  __m128 v;
+};
+struct Mask {
+  __m128 v;
+};
+
+inline Float broadcast(float x) { return {_mm_set1_ps(x)}; }
+inline Float load(const float* p) { return {_mm_loadu_ps(p)}; }
+inline void store(float* p, Float a) { _mm_storeu_ps(p, a.v); }
+inline Float gather(const float* base, Float index) {
+  // SSE has no gather instruction
+  alignas(16) float lanes[4];
+  _mm_store_ps(lanes, index.v);
+  return {_mm_setr_ps(base[static_cast<int>(lanes[0])],
+                      base[static_cast<int>(lanes[1])],
+                      base[static_cast<int>(lanes[2])],
+                      base[static_cast<int>(lanes[3])])};
+}
+
+inline Float operator+(Float a, Float b) { return {_mm_add_ps(a.v, b.v)}; }
+inline Float operator-(Float a, Float b) { return {_mm_sub_ps(a.v, b.v)}; }
+inline Float operator*(Float a, Float b) { return {_mm_mul_ps(a.v, b.v)}; }
+inline Float operator/(Float a, Float b) { return {_mm_div_ps(a.v, b.v)}; }
+inline Float fmadd(Float a, Float b, Float c) {
+  return {_mm_add_ps(_mm_mul_ps(a.v, b.v), c.v)};
+}
+inline Float floor(Float a) {
+#ifdef __SSE4_1__
+  return {_mm_floor_ps(a.v)};
+#else
+  // Truncate, then step down the lanes that were rounded up (negatives)
+  __m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(a.v));
+  __m128 above = _mm_cmpgt_ps(truncated, a.v);
+  return {_mm_sub_ps(truncated, _mm_and_ps(above, _mm_set1_ps(1.0f)))};
+#endif
+}
+inline Float sqrt(Float a) { return {_mm_sqrt_ps(a.v)}; }
+inline Float min(Float a, Float b) { return {_mm_min_ps(a.v, b.v)}; }
+
+inline Mask operator<(Float a, Float b) { return {_mm_cmplt_ps(a.v, b.v)}; }
+inline Mask operator>(Float a, Float b) { return {_mm_cmpgt_ps(a.v, b.v)}; }
+inline Mask operator&(Mask a, Mask b) { return {_mm_and_ps(a.v, b.v)}; }
+// Lanes of a where the mask is set, lanes of b elsewhere
+inline Float select(Mask m, Float a, Float b) {
+  return {_mm_or_ps(_mm_and_ps(m.v, a.v), _mm_andnot_ps(m.v, b.v))};
+}
+
+#else
+
+constexpr int WIDTH = 1;
+
+struct Float {
+  float v;
+};
+struct Mask {
+  bool v;
+};
+
+inline Float broadcast(float x) { return {x}; }
+inline Float load(const float* p) { return {*p}; }
+inline void store(float* p, Float a) { *p = a.v; }
+inline Float gather(const float* base, Float index) {
+  return {base[static_cast<int>(index.v)]};
+}
+
+inline Float operator+(Float a, Float b) { return {a.v + b.v}; }
+inline Float operator-(Float a, Float b) { return {a.v - b.v}; }
+inline Float operator*(Float a, Float b) { return {a.v * b.v}; }
+inline Float operator/(Float a, Float b) { return {a.v / b.v}; }
+inline Float fmadd(Float a, Float b, Float c) { return {a.v * b.v + c.v}; }
+inline Float floor(Float a) { return {std::floor(a.v)}; }
+inline Float sqrt(Float a) { return {std::sqrt(a.v)}; }
+inline Float min(Float a, Float b) { return {a.v < b.v ? a.v : b.v}; }
+
+inline Mask operator<(Float a, Float b) { return {a.v < b.v}; }
+inline Mask operator>(Float a, Float b) { return {a.v > b.v}; }
+inline Mask operator&(Mask a, Mask b) { return {a.v && b.v}; }
+// Lanes of a where the mask is set, lanes of b elsewhere
+inline Float select(Mask m, Float a, Float b) { return {m.v ? a.v : b.v}; }
+
+#endif
+
+inline Float negate(Float a) { return broadcast(0.0f) - a; }
+
+/**
+ * Sine and cosine of every lane.
+ *
+ * The argument is reduced to [-pi/4, pi/4] around the nearest multiple of
+ * pi/2 (in three parts, to keep precision for large angles) and both
+ * functions are approximated there with minimax polynomials. The quadrant
+ * then decides which result each lane gets and its sign.
+ */
+inline void sincos(Float x, Float& s, Float& c) {
+  const Float half = broadcast(0.5f);
+
+  Float quadrant = floor(fmadd(x, broadcast(0.63661977236f), half));
+  Float r = x - quadrant * broadcast(1.5703125f);
+  r = r - quadrant * broadcast(4.837512969970703125e-4f);
+  r = r - quadrant * broadcast(7.54978995489188216e-8f);
+  Float r2 = r * r;
+
+  Float sinPoly = fmadd(broadcast(-1.9515295891e-4f), r2,
+                        broadcast(8.3321608736e-3f));
+  sinPoly = fmadd(sinPoly, r2, broadcast(-1.6666654611e-1f));
+  sinPoly = fmadd(sinPoly * r2, r, r);
+
+  Float cosPoly = fmadd(broadcast(2.443315711809948e-5f), r2,
+                        broadcast(-1.388731625493765e-3f));
+  cosPoly = fmadd(cosPoly, r2, broadcast(4.166664568298827e-2f));
+  cosPoly = fmadd(cosPoly * r2, r2, broadcast(1.0f) - half * r2);
+
+  // Quadrant modulo 4, kept in floats
+  Float q = quadrant - broadcast(4.0f) * floor(quadrant * broadcast(0.25f));
+  Mask odd = (q - broadcast(2.0f) * floor(q * half)) > half;
+  Mask sinNegative = q > broadcast(1.5f);
+  Mask cosNegative = (q > half) & (q < broadcast(2.5f));
+
+  s = select(odd, cosPoly, sinPoly);
+  c = select(odd, sinPoly, cosPoly);
+  s = select(sinNegative, negate(s), s);
+  c = select(cosNegative, negate(c), c);
+}
+
+}  // namespace simd
+
+#endif  // SIMD_HPP
@@ -0,0 +1,64 @@
+#ifndef TRIPLEBUFFER_HPP
+#define TRIPLEBUFFER_HPP
+
+#include <atomic>
+
+/**
+ * Three slots handed between one writer and one reader without locks.
+ *
+ * The writer fills its back slot and publishes it; the reader takes the
+ * newest published slot and keeps reading it until it takes another. A
+ * third, spare slot is swapped between them, so neither ever waits for the
+ * other: a writer that runs ahead replaces the unread slot, and a reader
+ * that runs ahead keeps the slot it has.
+ *
+ * Slots are reused, so their storage (e.g. vectors) is only allocated while
+ * the first frames grow it.
+ */
+template <typename T>
+class TripleBuffer {
+ public:
+  TripleBuffer() = default;
+  TripleBuffer(const TripleBuffer&) = delete;
+  TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+  // Slot the writer fills next
+  T& back() { return _slots[_back]; }
+
+  // Hands the back slot to the reader, replacing one it hasn't taken
+  void publish() {
+    int spare = _spare.exchange(_back | FRESH, std::memory_order_acq_rel);
+    _back = spare & INDEX;
+  }
+
+  // Takes the newest published slot. False if nothing was published since
+  // the last call, and the front slot is unchanged
+  bool acquire() {
+    if (!(_spare.load(std::memory_order_relaxed) & FRESH)) {
+      return false;
+    }
+    int spare = _spare.exchange(_front, std::memory_order_acq_rel);
+    _front = spare & INDEX;
+    return true;
+  }
+
+  // Slot the reader took last
+  const T& front() const { return _slots[_front]; }
+
+  // Forgets anything published; only while neither side is running
+  void reset() {
+    _back = 0;
+    _front = 1;
+    _spare.store(2, std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr int INDEX = 3;  // Slot index bits of _spare
+  static constexpr int FRESH = 4;  // _spare was published and not taken
+
+  T _slots[3];
+  int _back = 0, _front = 1;
+  std::atomic<int> _spare{2};
+};
+
+#endif  // TRIPLEBUFFER_HPP
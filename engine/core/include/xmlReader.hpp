@@ -0,0 +1,95 @@
+#ifndef XMLREADER_HPP
+#define XMLREADER_HPP
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+enum XmlEvent { XML_START, XML_END, XML_EOF, XML_ERROR };
+
+/**
+ * Pull parser for an XML document read from a stream.
+ *
+ * next() advances to the next start or end tag, skipping text, comments,
+ * processing instructions and the doctype. The reader only keeps a fixed
+ * input buffer, the current tag and the names of the open elements, so its
+ * memory does not grow with the document.
+ *
+ * Malformed input stops it with an error that names the line. This covers
+ * mismatched or unclosed tags, bad attribute syntax, unknown entities and
+ * content outside the root element. Missing or non-numeric attributes that
+ * the caller asks for are reported the same way.
+ */
+class XmlReader {
+ public:
+  explicit XmlReader(std::istream& input, size_t bufferSize = 64 * 1024);
+
+  // Self-closing elements give a start and an end event
+  XmlEvent next();
+
+  /**
+   * Advances to the next child of the element opened at parentDepth,
+   * skipping whatever is left of the previous child.
+   *
+   * @return False once that element closes, or on an error
+   */
+  bool nextChild(size_t parentDepth);
+
+  // Name of the current tag
+  std::string_view name() const { return _tag.c_str(); }
+
+  // Open elements, counting the current start tag
+  size_t depth() const { return _open.size(); }
+
+  // Value of an attribute of the current start tag, null if it is missing
+  const char* attribute(std::string_view name) const;
+
+  // Required attributes: missing or malformed ones are errors
+  bool attribute(std::string_view name, const char*& value);
+  bool attribute(std::string_view name, float& value);
+  bool attribute(std::string_view name, int& value);
+
+  // Optional attributes keep their value if missing
+  bool optionalAttribute(std::string_view name, float& value);
+  bool optionalAttribute(std::string_view name, unsigned& value);
+
+  // Stops reading with an error at the current line; always returns false
+  bool fail(const std::string& message);
+
+  bool failed() const { return !_error.empty(); }
+  const std::string& error() const { return _error; }
+
+ private:
+  int peek();
+  int get();
+  bool refill();
+  bool expect(char c);
+  bool skipPast(std::string_view terminator);
+  bool readName(std::string& out);
+  bool readEntity(std::string* out);
+  bool readStartTag();
+  bool readEndTag();
+  bool readMarkup();
+  XmlEvent error(const std::string& message);
+
+  std::istream& _input;
+  std::unique_ptr<char[]> _buffer;
+  size_t _capacity, _size = 0, _position = 0;
+  size_t _line = 1;
+
+  // Name of the current tag, then the NUL-terminated attribute names and
+  // values, located by _attributes
+  std::string _tag;
+  std::vector<std::pair<size_t, size_t>> _attributes;
+  std::vector<std::string> _open;  // Names of the open elements
+
+  bool _selfClosing = false;  // An end event is due for the current tag
+  bool _rootOpened = false, _rootClosed = false;
+  std::string _error;
+};
+
+#endif  // XMLREADER_HPP
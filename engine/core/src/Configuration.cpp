@@ -0,0 +1,61 @@
+#include "Configuration.hpp"
+
+#include <new>
+#include <sstream>
+#include <string>
+#include <utility>
+
+// The group is move-constructed so it keeps the allocator it was built with
+Configuration::Configuration(const Window &window, const Camera &camera,
+                             ModelGroup group)
+    : modelGroup(std::move(group)) {
+  this->window = window;
+  this->camera = camera;
+  this->lights = {};
+}
+
+Configuration::Configuration(const Window &window, const Camera &camera,
+                             ModelGroup modelGroup, std::vector<Light> lights)
+    : modelGroup(std::move(modelGroup)) {
+  this->window = window;
+  this->camera = camera;
+  this->lights = std::move(lights);
+}
+
+/**
+ * Replaces this scene with another one, arena included.
+ *
+ * Assigning pmr containers never transfers the allocator, so the group is
+ * destroyed and move-constructed in place instead; only then the old arena
+ * is released.
+ */
+Configuration &Configuration::operator=(Configuration &&other) {
+  if (this == &other) {
+    return *this;
+  }
+  this->window = other.window;
+  this->camera = other.camera;
+  this->lights = std::move(other.lights);
+  this->modelGroup.~ModelGroup();
+  new (&this->modelGroup) ModelGroup(std::move(other.modelGroup));
+  this->arena = std::move(other.arena);
+  return *this;
+}
+
+bool Configuration::addLight(const Light &light) {
+  if (this->lights.size() > 8) {
+    return false;
+  }
+
+  this->lights.push_back(light);
+  return true;
+}
+
+bool Configuration::removeLight(int index) {
+  if (index < 0 || index >= this->lights.size()) {
+    return false;
+  }
+
+  this->lights.erase(this->lights.begin() + index);
+  return true;
+}
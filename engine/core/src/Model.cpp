@@ -0,0 +1,81 @@
+#include "Model.hpp"
+
+#include <atomic>
+#include <unordered_map>
+
+// Global counter for model IDs (models may be read on several threads)
+std::atomic<unsigned int> model_counter{0};
+
+/**
+ * Creates a vertex buffer with unique vertices
+ */
+std::vector<Vertex> createVertexBuffer(const std::vector<Vertex>& vertices) {
+  std::vector<Vertex> uniqueVertices;
+  std::unordered_map<Vertex, int, VertexHash> vertexIndices;
+
+  for (const Vertex& vertex : vertices) {
+    if (vertexIndices.find(vertex) == vertexIndices.end()) {
+      vertexIndices[vertex] = uniqueVertices.size();
+      uniqueVertices.push_back(vertex);
+    }
+  }
+  return uniqueVertices;
+}
+
+/**
+ * Creates an index buffer for the given vertices using the VBO as reference
+ */
+std::vector<unsigned int> createIndexBuffer(
+    const std::vector<Vertex>& vertices,
+    const std::vector<Vertex>& uniqueVertices) {
+  std::vector<unsigned int> indices;
+  indices.reserve(vertices.size());
+
+  std::unordered_map<Vertex, int, VertexHash> vertexIndices;
+  for (size_t i = 0; i < uniqueVertices.size(); ++i) {
+    vertexIndices[uniqueVertices[i]] = i;
+  }
+
+  for (const Vertex& vertex : vertices) {
+    indices.push_back(vertexIndices[vertex]);
+  }
+  return indices;
+}
+
+// Default constructor
+Model::Model() {
+  this->filename = "";
+  this->mesh = std::make_shared<Mesh>();
+  this->id = -1;
+  this->initialized = false;
+  model_counter++;
+}
+
+// Constructor that welds raw vertices into a new mesh
+Model::Model(std::string filename, std::vector<Vertex> points) {
+  this->filename = std::move(filename);
+  this->mesh = std::make_shared<Mesh>();
+  this->mesh->vbo = createVertexBuffer(points);
+  this->mesh->ibo = createIndexBuffer(points, this->mesh->vbo);
+  for (const Vertex& vertex : this->mesh->vbo) {
+    this->mesh->bounds.grow(
+        glm::vec3(vertex.position.x, vertex.position.y, vertex.position.z));
+  }
+  this->id = model_counter++;
+  this->initialized = false;
+}
+
+// Constructor for an indexed model file
+Model::Model(std::string filename, std::vector<Vertex> vbo,
+             std::vector<unsigned int> ibo) {
+  this->filename = std::move(filename);
+  this->mesh = std::make_shared<Mesh>();
+  this->mesh->vbo = std::move(vbo);
+  this->mesh->ibo = std::move(ibo);
+  for (const Vertex& vertex : this->mesh->vbo) {
+    this->mesh->bounds.grow(
+        glm::vec3(vertex.position.x, vertex.position.y, vertex.position.z));
+  }
+  this->id = model_counter++;
+  this->initialized = false;
+}
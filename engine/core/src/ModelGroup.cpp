@@ -0,0 +1,36 @@
+#include "ModelGroup.hpp"
+
+#include <utility>
+
+#include "utils.hpp"
+
+ModelGroup::ModelGroup(const allocator_type& alloc)
+    : name(alloc),
+      models(alloc),
+      instances(alloc),
+      subModelgroups(alloc),
+      static_transformations(alloc),
+      rotations(alloc),
+      translates(alloc),
+      order(alloc) {}
+
+ModelGroup::ModelGroup(const ModelGroup& other, const allocator_type& alloc)
+    : name(other.name, alloc),
+      models(other.models, alloc),
+      instances(other.instances, alloc),
+      subModelgroups(other.subModelgroups, alloc),
+      static_transformations(other.static_transformations, alloc),
+      rotations(other.rotations, alloc),
+      translates(other.translates, alloc),
+      order(other.order, alloc) {}
+
+// Only moves the buffers when both groups share the allocator
+ModelGroup::ModelGroup(ModelGroup&& other, const allocator_type& alloc)
+    : name(std::move(other.name), alloc),
+      models(std::move(other.models), alloc),
+      instances(std::move(other.instances), alloc),
+      subModelgroups(std::move(other.subModelgroups), alloc),
+      static_transformations(std::move(other.static_transformations), alloc),
+      rotations(std::move(other.rotations), alloc),
+      translates(std::move(other.translates), alloc),
+      order(std::move(other.order), alloc) {}
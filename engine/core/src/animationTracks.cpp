@@ -0,0 +1,259 @@
+#include "animationTracks.hpp"
+
+#define _USE_MATH_DEFINES
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "simd.hpp"
+
+using simd::Float;
+
+static void normalize(Float v[3]) {
+  Float length = simd::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+  v[0] = v[0] / length;
+  v[1] = v[1] / length;
+  v[2] = v[2] / length;
+}
+
+static void cross(const Float a[3], const Float b[3], Float out[3]) {
+  out[0] = a[1] * b[2] - a[2] * b[1];
+  out[1] = a[2] * b[0] - a[0] * b[2];
+  out[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+/**
+ * Copies the lanes of 3x4 column vectors into the output matrices
+ */
+static void storeMatrices(float columns[12][simd::WIDTH], size_t lanes,
+                          glm::mat4* out) {
+  for (size_t lane = 0; lane < lanes; lane++) {
+    glm::mat4& matrix = out[lane];
+    for (int column = 0; column < 4; column++) {
+      matrix[column] = glm::vec4(columns[column * 3 + 0][lane],
+                                 columns[column * 3 + 1][lane],
+                                 columns[column * 3 + 2][lane],
+                                 column == 3 ? 1.0f : 0.0f);
+    }
+  }
+}
+
+void AnimationTracks::clear() {
+  _rotationCount = 0;
+  _translationCount = 0;
+  _rotationPeriod.clear();
+  _axisX.clear();
+  _axisY.clear();
+  _axisZ.clear();
+  _translationPeriod.clear();
+  _segmentOffset.clear();
+  _segmentCount.clear();
+  _align.clear();
+  _upX.clear();
+  _upY.clear();
+  _upZ.clear();
+  _constantSpeed.clear();
+  for (std::vector<float>& coefficient : _coefficients) {
+    coefficient.clear();
+  }
+  _curves = nullptr;
+}
+
+void AnimationTracks::build(
+    const std::vector<TimeRotations>& rotations,
+    const std::vector<TimeTranslations>& translations) {
+  clear();
+
+  // Arrays are padded by one vector so the last batch can load full lanes.
+  // Padding and disabled tracks never advance and evaluate to the identity
+  const float never = std::numeric_limits<float>::infinity();
+  _rotationCount = rotations.size();
+  size_t padded = _rotationCount + simd::WIDTH;
+  _rotationPeriod.assign(padded, never);
+  _axisX.assign(padded, 0.0f);
+  _axisY.assign(padded, 0.0f);
+  _axisZ.assign(padded, 1.0f);
+  for (size_t i = 0; i < _rotationCount; i++) {
+    const TimeRotations& rotation = rotations[i];
+    float length = std::sqrt(rotation.x * rotation.x +
+                             rotation.y * rotation.y +
+                             rotation.z * rotation.z);
+    if (rotation.time == 0 || length == 0) {
+      continue;
+    }
+    _rotationPeriod[i] = rotation.time;
+    _axisX[i] = rotation.x / length;
+    _axisY[i] = rotation.y / length;
+    _axisZ[i] = rotation.z / length;
+  }
+
+  _translationCount = translations.size();
+  padded = _translationCount + simd::WIDTH;
+  _translationPeriod.assign(padded, never);
+  _segmentOffset.assign(padded, 0.0f);
+  _segmentCount.assign(padded, 1.0f);
+  _align.assign(padded, 0.0f);
+  _upX.assign(padded, 0.0f);
+  _upY.assign(padded, 1.0f);
+  _upZ.assign(padded, 0.0f);
+  _constantSpeed.assign(padded, 0);
+
+  // Segment 0 is all zeros and stands in for tracks without a curve
+  for (std::vector<float>& coefficient : _coefficients) {
+    coefficient.assign(1, 0.0f);
+  }
+
+  for (size_t i = 0; i < _translationCount; i++) {
+    const TimeTranslations& translation = translations[i];
+    if (translation.time == 0 || translation.segments.empty()) {
+      continue;
+    }
+    _translationPeriod[i] = translation.time;
+    _segmentOffset[i] = static_cast<float>(_coefficients[0].size());
+    _segmentCount[i] = static_cast<float>(translation.segments.size());
+    _align[i] = translation.align ? 1.0f : 0.0f;
+    _upX[i] = translation.y_axis.x;
+    _upY[i] = translation.y_axis.y;
+    _upZ[i] = translation.y_axis.z;
+    _constantSpeed[i] =
+        translation.constant_speed && !translation.arcLengths.empty();
+
+    for (const CurveSegment& segment : translation.segments) {
+      const Point* terms[4] = {&segment.a, &segment.b, &segment.c,
+                               &segment.d};
+      for (int term = 0; term < 4; term++) {
+        _coefficients[term * 3 + 0].push_back(terms[term]->x);
+        _coefficients[term * 3 + 1].push_back(terms[term]->y);
+        _coefficients[term * 3 + 2].push_back(terms[term]->z);
+      }
+    }
+  }
+
+  _curves = &translations;
+}
+
+/**
+ * Same matrix as glm::rotate(angle, axis) with the angle in turns of
+ * elapsed_time / time
+ */
+void AnimationTracks::evaluateRotations(float elapsed_time, size_t begin,
+                                        size_t end, glm::mat4* out) const {
+  const Float time = simd::broadcast(elapsed_time);
+  const Float one = simd::broadcast(1.0f);
+  alignas(64) float columns[12][simd::WIDTH];
+
+  // The translation column stays zero
+  for (int row = 9; row < 12; row++) {
+    std::fill(columns[row], columns[row] + simd::WIDTH, 0.0f);
+  }
+
+  for (size_t first = begin; first < end; first += simd::WIDTH) {
+    size_t lanes = std::min<size_t>(simd::WIDTH, end - first);
+
+    // Wrap to one turn before converting, so precision does not degrade
+    // as the animation time grows
+    Float turns = time / simd::load(&_rotationPeriod[first]);
+    Float angle =
+        (turns - simd::floor(turns)) * simd::broadcast(2.0f * M_PI);
+    Float s, c;
+    simd::sincos(angle, s, c);
+
+    Float x = simd::load(&_axisX[first]);
+    Float y = simd::load(&_axisY[first]);
+    Float z = simd::load(&_axisZ[first]);
+    Float k = one - c;
+    Float kx = k * x, ky = k * y, kz = k * z;
+
+    simd::store(columns[0], simd::fmadd(kx, x, c));
+    simd::store(columns[1], simd::fmadd(kx, y, s * z));
+    simd::store(columns[2], kx * z - s * y);
+    simd::store(columns[3], ky * x - s * z);
+    simd::store(columns[4], simd::fmadd(ky, y, c));
+    simd::store(columns[5], simd::fmadd(ky, z, s * x));
+    simd::store(columns[6], simd::fmadd(kz, x, s * y));
+    simd::store(columns[7], kz * y - s * x);
+    simd::store(columns[8], simd::fmadd(kz, z, c));
+
+    storeMatrices(columns, lanes, out + first);
+  }
+}
+
+/**
+ * Same matrix as TimeTranslations::applyTimeTranslations
+ */
+void AnimationTracks::evaluateTranslations(float elapsed_time, size_t begin,
+                                           size_t end, glm::mat4* out) const {
+  const Float time = simd::broadcast(elapsed_time);
+  const Float zero = simd::broadcast(0.0f);
+  const Float one = simd::broadcast(1.0f);
+  alignas(64) float parameters[simd::WIDTH];
+  alignas(64) float columns[12][simd::WIDTH];
+
+  for (size_t first = begin; first < end; first += simd::WIDTH) {
+    size_t lanes = std::min<size_t>(simd::WIDTH, end - first);
+
+    Float loops = time / simd::load(&_translationPeriod[first]);
+    Float count = simd::load(&_segmentCount[first]);
+    Float parameter = (loops - simd::floor(loops)) * count;
+
+    // Constant speed curves go through their arc length table instead
+    bool remap = false;
+    for (size_t lane = 0; lane < lanes; lane++) {
+      remap |= _constantSpeed[first + lane] != 0;
+    }
+    if (remap) {
+      simd::store(parameters, parameter);
+      for (size_t lane = 0; lane < lanes; lane++) {
+        size_t track = first + lane;
+        if (_constantSpeed[track]) {
+          parameters[lane] = (*_curves)[track].curveParameter(
+              elapsed_time / _translationPeriod[track]);
+        }
+      }
+      parameter = simd::load(parameters);
+    }
+
+    Float segment = simd::min(simd::floor(parameter), count - one);
+    Float t = parameter - segment;
+    Float index = simd::load(&_segmentOffset[first]) + segment;
+
+    Float position[3], forward[3];
+    for (int axis = 0; axis < 3; axis++) {
+      Float a = simd::gather(_coefficients[0 + axis].data(), index);
+      Float b = simd::gather(_coefficients[3 + axis].data(), index);
+      Float c = simd::gather(_coefficients[6 + axis].data(), index);
+      Float d = simd::gather(_coefficients[9 + axis].data(), index);
+      position[axis] =
+          simd::fmadd(simd::fmadd(simd::fmadd(a, t, b), t, c), t, d);
+      forward[axis] =
+          simd::fmadd(simd::fmadd(simd::broadcast(3.0f) * a, t,
+                                  simd::broadcast(2.0f) * b),
+                      t, c);
+    }
+
+    // Frame from the tangent and the curve's up vector
+    Float up[3] = {simd::load(&_upX[first]), simd::load(&_upY[first]),
+                   simd::load(&_upZ[first])};
+    Float right[3], normal[3];
+    normalize(forward);
+    cross(forward, up, right);
+    normalize(right);
+    cross(right, forward, normal);
+    normalize(normal);
+
+    simd::Mask aligned = simd::load(&_align[first]) > simd::broadcast(0.5f);
+    const Float* axes[3] = {forward, normal, right};
+    for (int column = 0; column < 3; column++) {
+      for (int row = 0; row < 3; row++) {
+        Float identity = column == row ? one : zero;
+        simd::store(columns[column * 3 + row],
+                    simd::select(aligned, axes[column][row], identity));
+      }
+    }
+    simd::store(columns[9], position[0]);
+    simd::store(columns[10], position[1]);
+    simd::store(columns[11], position[2]);
+
+    storeMatrices(columns, lanes, out + first);
+  }
+}
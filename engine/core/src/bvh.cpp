@@ -0,0 +1,318 @@
+#include "bvh.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <queue>
+
+// Largest number of instances kept in one leaf
+static const int LEAF_SIZE = 4;
+
+static double millisecondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+Frustum::Frustum(const glm::mat4& viewProjection) {
+  // Rows of the matrix (glm is column-major); each plane is row 3 +- row i
+  glm::vec4 rows[4];
+  for (int i = 0; i < 4; i++) {
+    rows[i] = glm::vec4(viewProjection[0][i], viewProjection[1][i],
+                        viewProjection[2][i], viewProjection[3][i]);
+  }
+
+  for (int i = 0; i < 3; i++) {
+    planes[2 * i] = rows[3] + rows[i];
+    planes[2 * i + 1] = rows[3] - rows[i];
+  }
+}
+
+bool Frustum::intersects(const AABB& box) const {
+  for (const glm::vec4& plane : planes) {
+    // Corner of the box furthest along the plane normal
+    glm::vec3 corner(plane.x >= 0 ? box.max.x : box.min.x,
+                     plane.y >= 0 ? box.max.y : box.min.y,
+                     plane.z >= 0 ? box.max.z : box.min.z);
+    if (glm::dot(glm::vec3(plane), corner) + plane.w < 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void BVH::clear() {
+  _bounds.clear();
+  _modelCount = 0;
+  _instances.clear();
+  _setFirst.clear();
+  _static = Tree();
+  _dynamic = Tree();
+  _built = false;
+}
+
+void BVH::updateBounds(const SceneGraph& graph,
+                       const std::vector<int>& items) {
+  for (int item : items) {
+    if (!isInstance(item)) {
+      _bounds[item] = graph.models[item]->mesh->bounds.transformed(
+          graph.world[graph.model_node[item]]);
+      continue;
+    }
+    InstanceRef ref = instance(item);
+    const InstanceSet& set = *graph.instance_sets[ref.set];
+    _bounds[item] = set.model.mesh->bounds.transformed(
+        graph.world[graph.instance_node[ref.set]] *
+        set.matrices()[ref.instance]);
+  }
+}
+
+void BVH::build(const SceneGraph& graph) {
+  auto start = std::chrono::steady_clock::now();
+  clear();
+
+  // A node moves if it or any ancestor has a timed transform; parents come
+  // first, so one pass over the nodes is enough
+  std::vector<uint8_t> moving(graph.size());
+  for (size_t node = 0; node < graph.size(); node++) {
+    int p = graph.parent[node];
+    moving[node] = graph.animated[node] || (p >= 0 && moving[p]);
+  }
+
+  _modelCount = graph.models.size();
+  for (size_t m = 0; m < graph.models.size(); m++) {
+    // Models without geometry can never be hit or seen
+    if (graph.models[m]->mesh->vbo.empty()) continue;
+    Tree& tree = moving[graph.model_node[m]] ? _dynamic : _static;
+    tree.items.push_back(static_cast<int>(m));
+  }
+
+  // Every instance gets an item, so instanceItem() is an offset into its
+  // set, but only those with geometry go into the tree
+  for (size_t s = 0; s < graph.instance_sets.size(); s++) {
+    const InstanceSet& set = *graph.instance_sets[s];
+    _setFirst.push_back(static_cast<int>(_modelCount + _instances.size()));
+    for (size_t i = 0; i < set.size(); i++) {
+      if (!set.model.mesh->vbo.empty()) {
+        _dynamic.items.push_back(
+            static_cast<int>(_modelCount + _instances.size()));
+      }
+      _instances.push_back({static_cast<int>(s), static_cast<int>(i)});
+    }
+  }
+  _bounds.resize(_modelCount + _instances.size());
+
+  updateBounds(graph, _static.items);
+  updateBounds(graph, _dynamic.items);
+  buildTree(_static);
+  buildTree(_dynamic);
+
+  _built = true;
+  _buildMs = millisecondsSince(start);
+}
+
+void BVH::buildTree(Tree& tree) {
+  if (tree.items.empty()) return;
+  tree.nodes.reserve(2 * tree.items.size());
+  tree.nodes.push_back({});
+  split(tree, 0, 0, static_cast<int>(tree.items.size()));
+}
+
+/**
+ * Turns the node into a leaf over items [begin, end), or splits the items at
+ * the median centroid along the axis where the centroids spread the most
+ */
+void BVH::split(Tree& tree, int node, int begin, int end) {
+  AABB box, centroids;
+  for (int i = begin; i < end; i++) {
+    box.grow(_bounds[tree.items[i]]);
+    centroids.grow(_bounds[tree.items[i]].center());
+  }
+  tree.nodes[node].box = box;
+
+  if (end - begin <= LEAF_SIZE) {
+    tree.nodes[node].first = begin;
+    tree.nodes[node].count = end - begin;
+    return;
+  }
+
+  glm::vec3 spread = centroids.max - centroids.min;
+  int axis = spread.x > spread.y ? (spread.x > spread.z ? 0 : 2)
+                                 : (spread.y > spread.z ? 1 : 2);
+  int mid = begin + (end - begin) / 2;
+  std::nth_element(tree.items.begin() + begin, tree.items.begin() + mid,
+                   tree.items.begin() + end, [&](int a, int b) {
+                     return _bounds[a].center()[axis] <
+                            _bounds[b].center()[axis];
+                   });
+
+  // Siblings are allocated together so the right child is first + 1
+  int left = static_cast<int>(tree.nodes.size());
+  tree.nodes.push_back({});
+  tree.nodes.push_back({});
+  tree.nodes[node].first = left;
+  tree.nodes[node].count = 0;
+
+  split(tree, left, begin, mid);
+  split(tree, left + 1, mid, end);
+}
+
+void BVH::refit(const SceneGraph& graph) {
+  auto start = std::chrono::steady_clock::now();
+  updateBounds(graph, _dynamic.items);
+  refitTree(_dynamic);
+  _refitMs = millisecondsSince(start);
+}
+
+void BVH::refitTree(Tree& tree) {
+  // Children have larger indices than their parent, so walking backwards
+  // visits every child before the node that encloses it
+  for (size_t i = tree.nodes.size(); i-- > 0;) {
+    Node& node = tree.nodes[i];
+    AABB box;
+    if (node.count > 0) {
+      for (int item = node.first; item < node.first + node.count; item++) {
+        box.grow(_bounds[tree.items[item]]);
+      }
+    } else {
+      box.grow(tree.nodes[node.first].box);
+      box.grow(tree.nodes[node.first + 1].box);
+    }
+    node.box = box;
+  }
+}
+
+/**
+ * Depth-first traversal calling visit(item) for every item whose bounds
+ * pass overlaps(box), skipping subtrees whose bounds do not
+ */
+template <typename Overlaps, typename Visit>
+void BVH::traverse(const Tree& tree, Overlaps overlaps, Visit visit) const {
+  if (tree.nodes.empty()) return;
+
+  int stack[64];
+  int top = 0;
+  stack[top++] = 0;
+  while (top > 0) {
+    const Node& node = tree.nodes[stack[--top]];
+    if (!overlaps(node.box)) continue;
+
+    if (node.count == 0) {
+      stack[top++] = node.first;
+      stack[top++] = node.first + 1;
+      continue;
+    }
+
+    for (int i = node.first; i < node.first + node.count; i++) {
+      int item = tree.items[i];
+      if (overlaps(_bounds[item])) visit(item);
+    }
+  }
+}
+
+void BVH::queryFrustum(const Frustum& frustum, std::vector<int>& out) const {
+  out.clear();
+  auto overlaps = [&](const AABB& box) { return frustum.intersects(box); };
+  auto visit = [&](int item) { out.push_back(item); };
+  traverse(_static, overlaps, visit);
+  traverse(_dynamic, overlaps, visit);
+}
+
+void BVH::queryFrustum(const Frustum& frustum, std::vector<int>& models,
+                       std::vector<std::vector<int>>& instances) const {
+  models.clear();
+  instances.resize(_setFirst.size());
+  for (std::vector<int>& set : instances) set.clear();
+
+  auto overlaps = [&](const AABB& box) { return frustum.intersects(box); };
+  auto visit = [&](int item) {
+    if (!isInstance(item)) {
+      models.push_back(item);
+      return;
+    }
+    InstanceRef ref = instance(item);
+    instances[ref.set].push_back(ref.instance);
+  };
+  traverse(_static, overlaps, visit);
+  traverse(_dynamic, overlaps, visit);
+
+  for (std::vector<int>& set : instances) std::sort(set.begin(), set.end());
+}
+
+void BVH::querySphere(const glm::vec3& center, float radius,
+                      std::vector<int>& out) const {
+  out.clear();
+  float radius2 = radius * radius;
+  auto overlaps = [&](const AABB& box) {
+    return box.distance2(center) <= radius2;
+  };
+  auto visit = [&](int item) { out.push_back(item); };
+  traverse(_static, overlaps, visit);
+  traverse(_dynamic, overlaps, visit);
+}
+
+void BVH::queryRay(const glm::vec3& origin, const glm::vec3& direction,
+                   std::vector<std::pair<float, int>>& out) const {
+  out.clear();
+  glm::vec3 inverse = glm::vec3(1.0f) / direction;
+
+  // Slab test; entry is clamped to 0 so a ray starting inside a box hits it
+  float entry = 0.0f;
+  auto overlaps = [&](const AABB& box) {
+    glm::vec3 t0 = (box.min - origin) * inverse;
+    glm::vec3 t1 = (box.max - origin) * inverse;
+    glm::vec3 near = glm::min(t0, t1), far = glm::max(t0, t1);
+    entry = std::max(std::max(near.x, near.y), std::max(near.z, 0.0f));
+    float exit = std::min(std::min(far.x, far.y), far.z);
+    return entry <= exit;
+  };
+  auto visit = [&](int item) { out.emplace_back(entry, item); };
+  traverse(_static, overlaps, visit);
+  traverse(_dynamic, overlaps, visit);
+
+  std::sort(out.begin(), out.end());
+}
+
+void BVH::queryNearest(const glm::vec3& point, size_t k,
+                       std::vector<int>& out) const {
+  out.clear();
+
+  // Best-first search over nodes and items together. An item is never
+  // closer than the node holding it, so items come out in distance order
+  struct Entry {
+    float distance;
+    const Tree* tree;
+    int node;  // -1 for an item
+    int item;  // Set for items
+    bool operator>(const Entry& other) const {
+      return distance > other.distance;
+    }
+  };
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+  for (const Tree* tree : {&_static, &_dynamic}) {
+    if (!tree->nodes.empty()) {
+      queue.push({tree->nodes[0].box.distance2(point), tree, 0, -1});
+    }
+  }
+
+  while (!queue.empty() && out.size() < k) {
+    Entry entry = queue.top();
+    queue.pop();
+    if (entry.node < 0) {
+      out.push_back(entry.item);
+      continue;
+    }
+
+    const Tree& tree = *entry.tree;
+    const Node& node = tree.nodes[entry.node];
+    if (node.count == 0) {
+      for (int child : {node.first, node.first + 1}) {
+        queue.push({tree.nodes[child].box.distance2(point), &tree, child, -1});
+      }
+      continue;
+    }
+    for (int i = node.first; i < node.first + node.count; i++) {
+      int item = tree.items[i];
+      queue.push({_bounds[item].distance2(point), &tree, -1, item});
+    }
+  }
+}
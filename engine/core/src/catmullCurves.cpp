@@ -0,0 +1,287 @@
+#include <stdlib.h>
+#define _USE_MATH_DEFINES
+#include <algorithm>
+#include <cmath>
+#include <glm/gtc/type_ptr.hpp>
+#include <utility>
+#include <vector>
+
+#include "catmullCurves.hpp"
+#include "utils.hpp"
+
+static const std::array<std::array<float, 4>, 4> catmoll_rom_matrix{{
+    {-0.5f, +1.5f, -1.5f, +0.5f},
+    {+1.0f, -2.5f, +2.0f, -0.5f},
+    {-0.5f, +0.0f, +0.5f, +0.0f},
+    {+0.0f, +1.0f, +0.0f, +0.0f},
+}};
+
+std::pair<Point, Point> catmollRomPosition(std::vector<Point> curve,
+                                           float global_time) {
+  const auto basis = catmoll_rom_matrix;
+
+  float scaled_t = global_time * curve.size();
+  int segment_idx = static_cast<int>(std::floor(scaled_t));
+  float local_t = scaled_t - segment_idx;
+
+  int idx = segment_idx + curve.size() - 1;
+  Point pt0 = curve[(idx + 0) % curve.size()];
+  Point pt1 = curve[(idx + 1) % curve.size()];
+  Point pt2 = curve[(idx + 2) % curve.size()];
+  Point pt3 = curve[(idx + 3) % curve.size()];
+
+  std::array<std::array<float, 4>, 3> geometry{{
+      {pt0.x, pt1.x, pt2.x, pt3.x},
+      {pt0.y, pt1.y, pt2.y, pt3.y},
+      {pt0.z, pt1.z, pt2.z, pt3.z},
+  }};
+
+  std::array<float, 4> timeVector = {local_t * local_t * local_t,
+                                     local_t * local_t, local_t, 1.0f};
+  std::array<float, 4> timeDerivative = {3 * local_t * local_t, 2 * local_t,
+                                         1.0f, 0.0f};
+
+  std::array<float, 3> pos{};
+  std::array<float, 3> deriv{};
+
+  for (size_t axis = 0; axis < 3; ++axis) {
+    std::array<float, 4> coeffs{};
+
+    for (size_t row = 0; row < 4; ++row) {
+      for (size_t col = 0; col < 4; ++col) {
+        coeffs[row] += geometry[axis][col] * basis[row][col];
+      }
+    }
+
+    for (size_t k = 0; k < 4; ++k) {
+      pos[axis] += timeVector[k] * coeffs[k];
+      deriv[axis] += timeDerivative[k] * coeffs[k];
+    }
+  }
+
+  return {
+      Point(pos[0], pos[1], pos[2]),
+      Point(deriv[0], deriv[1], deriv[2]),
+  };
+}
+
+TimeRotations::TimeRotations() {
+  this->time = 0;
+  this->x = 0;
+  this->y = 0;
+  this->z = 0;
+}
+
+TimeRotations::TimeRotations(float time, float x, float y, float z) {
+  this->time = time;
+  this->x = x;
+  this->y = y;
+  this->z = z;
+}
+
+glm::mat4 TimeRotations::applyTimeRotation(float elapsed_time) {
+  if (this->time == 0) {
+    return glm::mat4(1.0f);
+  }
+  float angle = 360.0f * (elapsed_time / this->time);
+  return glm::rotate(glm::mat4(1.0f), glm::radians(angle),
+                     glm::vec3(this->x, this->y, this->z));
+}
+
+/**
+ * Weighted sum of four points, one weight per row of the basis matrix
+ */
+static Point combine(const std::array<float, 4>& w, const Point& p0,
+                     const Point& p1, const Point& p2, const Point& p3) {
+  return Point(w[0] * p0.x + w[1] * p1.x + w[2] * p2.x + w[3] * p3.x,
+               w[0] * p0.y + w[1] * p1.y + w[2] * p2.y + w[3] * p3.y,
+               w[0] * p0.z + w[1] * p1.z + w[2] * p2.z + w[3] * p3.z);
+}
+
+/**
+ * Evaluates a segment and its derivative with Horner's scheme
+ */
+static std::pair<Point, Point> evaluateSegment(const CurveSegment& s,
+                                               float t) {
+  Point pos(((s.a.x * t + s.b.x) * t + s.c.x) * t + s.d.x,
+            ((s.a.y * t + s.b.y) * t + s.c.y) * t + s.d.y,
+            ((s.a.z * t + s.b.z) * t + s.c.z) * t + s.d.z);
+  Point deriv((3 * s.a.x * t + 2 * s.b.x) * t + s.c.x,
+              (3 * s.a.y * t + 2 * s.b.y) * t + s.c.y,
+              (3 * s.a.z * t + 2 * s.b.z) * t + s.c.z);
+  return {pos, deriv};
+}
+
+TimeTranslations::TimeTranslations(const allocator_type& alloc)
+    : curvePoints(alloc), segments(alloc), arcLengths(alloc) {
+  this->time = 0;
+  this->align = false;
+  this->constant_speed = false;
+  this->y_axis = Point(0, 1, 0);
+}
+
+TimeTranslations::TimeTranslations(const TimeTranslations& other,
+                                   const allocator_type& alloc)
+    : time(other.time),
+      align(other.align),
+      constant_speed(other.constant_speed),
+      curvePoints(other.curvePoints, alloc),
+      y_axis(other.y_axis),
+      segments(other.segments, alloc),
+      arcLengths(other.arcLengths, alloc) {}
+
+TimeTranslations::TimeTranslations(TimeTranslations&& other,
+                                   const allocator_type& alloc)
+    : time(other.time),
+      align(other.align),
+      constant_speed(other.constant_speed),
+      curvePoints(std::move(other.curvePoints), alloc),
+      y_axis(other.y_axis),
+      segments(std::move(other.segments), alloc),
+      arcLengths(std::move(other.arcLengths), alloc) {}
+
+TimeTranslations::TimeTranslations(float time, bool align,
+                                   std::pmr::vector<Point> curve,
+                                   bool constant_speed,
+                                   const allocator_type& alloc)
+    : curvePoints(std::move(curve), alloc), segments(alloc), arcLengths(alloc) {
+  this->time = time;
+  this->align = align;
+  this->constant_speed = constant_speed;
+  this->y_axis = Point(0, 1, 0);
+
+  // Segment i goes from point i to point i + 1 and uses points i - 1 and
+  // i + 2 as tangent controls, wrapping around the loop
+  const auto& basis = catmoll_rom_matrix;
+  size_t n = this->curvePoints.size();
+  this->segments.reserve(n);
+  for (size_t i = 0; i < n; i++) {
+    const Point& p0 = this->curvePoints[(i + n - 1) % n];
+    const Point& p1 = this->curvePoints[i];
+    const Point& p2 = this->curvePoints[(i + 1) % n];
+    const Point& p3 = this->curvePoints[(i + 2) % n];
+    this->segments.push_back({combine(basis[0], p0, p1, p2, p3),
+                              combine(basis[1], p0, p1, p2, p3),
+                              combine(basis[2], p0, p1, p2, p3),
+                              combine(basis[3], p0, p1, p2, p3)});
+  }
+
+  if (this->constant_speed && n > 0) {
+    // Chord lengths between uniform parameter steps approximate arc length
+    this->arcLengths.reserve(n * ARC_SAMPLES + 1);
+    this->arcLengths.push_back(0.0f);
+    Point previous = this->segments[0].d;
+    for (const CurveSegment& segment : this->segments) {
+      for (int k = 1; k <= ARC_SAMPLES; k++) {
+        Point current =
+            evaluateSegment(segment, static_cast<float>(k) / ARC_SAMPLES)
+                .first;
+        float dx = current.x - previous.x;
+        float dy = current.y - previous.y;
+        float dz = current.z - previous.z;
+        this->arcLengths.push_back(this->arcLengths.back() +
+                                   std::sqrt(dx * dx + dy * dy + dz * dz));
+        previous = current;
+      }
+    }
+  }
+}
+
+float TimeTranslations::curveParameter(float fraction) const {
+  size_t n = this->segments.size();
+  float parameter = (fraction - std::floor(fraction)) * n;
+
+  if (this->constant_speed && !this->arcLengths.empty() &&
+      this->arcLengths.back() > 0.0f) {
+    // Invert the arc length table: find the sample interval containing the
+    // target length and interpolate the parameter inside it
+    float target = (fraction - std::floor(fraction)) * this->arcLengths.back();
+    auto it = std::upper_bound(this->arcLengths.begin(),
+                               this->arcLengths.end(), target);
+    size_t sample = std::clamp<size_t>(it - this->arcLengths.begin(), 1,
+                                       this->arcLengths.size() - 1) -
+                    1;
+    float start = this->arcLengths[sample];
+    float length = this->arcLengths[sample + 1] - start;
+    float within = length > 0.0f ? (target - start) / length : 0.0f;
+    parameter = (sample + within) / ARC_SAMPLES;
+  }
+
+  return parameter;
+}
+
+std::pair<Point, Point> TimeTranslations::evaluate(float fraction) const {
+  size_t n = this->segments.size();
+  if (n == 0) {
+    return {Point(), Point(1, 0, 0)};
+  }
+
+  // Curve parameter in segments, in [0, n)
+  float parameter = this->curveParameter(fraction);
+  size_t segment = std::min(static_cast<size_t>(parameter), n - 1);
+  return evaluateSegment(this->segments[segment], parameter - segment);
+}
+
+std::pair<Point, Point> TimeTranslations::getLocation(float elapsed_time) {
+  return evaluate(elapsed_time / this->time);
+}
+
+std::array<float, 16> TimeTranslations::rotationMatrix(Point x_axis,
+                                                       Point y_axis,
+                                                       Point z_axis) {
+  return std::array<float, 16>{{
+      x_axis.x,
+      x_axis.y,
+      x_axis.z,
+      0,
+      y_axis.x,
+      y_axis.y,
+      y_axis.z,
+      0,
+      z_axis.x,
+      z_axis.y,
+      z_axis.z,
+      0,
+      0,
+      0,
+      0,
+      1,
+  }};
+}
+
+glm::mat4 TimeTranslations::applyTimeTranslations(float elapsed_time) {
+  if (this->time == 0) {
+    return glm::mat4(1.0f);
+  }
+
+  auto [pos, dir] = this->evaluate(elapsed_time / this->time);
+
+  glm::mat4 transform = glm::mat4(1.0f);
+  transform = glm::translate(transform, glm::vec3(pos.x, pos.y, pos.z));
+
+  if (this->align) {
+    Point forward = dir.normalize();
+    Point right = forward.cross(this->y_axis).normalize();
+    Point up = right.cross(forward).normalize();
+    auto rot_array = this->rotationMatrix(forward, up, right);
+    glm::mat4 rot_matrix = glm::make_mat4(rot_array.data());
+    transform *= rot_matrix;
+  }
+
+  return transform;
+}
+
+glm::mat4 Scalematrix(float x, float y, float z) {
+  glm::mat4 mat = glm::mat4(1.0f);
+  return glm::scale(mat, glm::vec3(x, y, z));
+}
+
+glm::mat4 Translatematrix(float x, float y, float z) {
+  glm::mat4 mat = glm::mat4(1.0f);
+  return glm::translate(mat, glm::vec3(x, y, z));
+}
+
+glm::mat4 Rotationmatrix(float angle, float x, float y, float z) {
+  glm::mat4 mat = glm::mat4(1.0f);
+  return glm::rotate(mat, glm::radians(angle), glm::vec3(x, y, z));
+}
@@ -0,0 +1,565 @@
+#include "filesParser.hpp"
+
+#include <fmt/core.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "readFile.hpp"
+#include "shapeBuilder.hpp"
+
+/**
+ * Collects the model and texture files the scene refers to. Reading the
+ * whole document also checks that it is well-formed.
+ */
+static bool collectFiles(XmlReader& reader, std::vector<std::string>& models,
+                         std::vector<std::string>& textures) {
+  for (XmlEvent event = reader.next(); event != XML_EOF;
+       event = reader.next()) {
+    if (event == XML_ERROR) {
+      return false;
+    }
+    if (event != XML_START) {
+      continue;
+    }
+
+    std::string_view element = reader.name();
+    // Procedural models are built while parsing, with no file to read
+    if (element == "model" && reader.attribute("procedural")) {
+      continue;
+    }
+    if (element == "model" || element == "texture") {
+      if (const char* file = reader.attribute("file")) {
+        (element == "model" ? models : textures).push_back(file);
+      }
+    } else if (element == "instances") {
+      if (const char* model = reader.attribute("model")) {
+        models.push_back(model);
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * Reads three required attributes into a vector
+ */
+static bool readVector(XmlReader& reader, const char* x, const char* y,
+                       const char* z, glm::vec3& vector) {
+  return reader.attribute(x, vector.x) && reader.attribute(y, vector.y) &&
+         reader.attribute(z, vector.z);
+}
+
+/**
+ * Reads an R, G, B color in [0, 255]
+ */
+static bool readColor(XmlReader& reader, glm::vec4& color) {
+  glm::vec3 rgb;
+  if (!readVector(reader, "R", "G", "B", rgb)) {
+    return false;
+  }
+  color = glm::vec4(rgb.x / 255.0f, rgb.y / 255.0f, rgb.z / 255.0f, 1.0f);
+  return true;
+}
+
+Configuration parseSceneFile(std::string sceneFile, JobSystem* jobs) {
+  // Parse scene based on file extension
+  std::string extension = std::filesystem::path(sceneFile).extension().string();
+  if (extension == ".xml") {
+    return parseConfig(sceneFile, jobs);
+  } else if (extension == ".3d") {
+    return parseConfig3D(sceneFile);
+  } else if (extension == ".obj") {
+    return parseConfigObj(sceneFile);
+  }
+
+  std::cout << "Unsupported file format: " << sceneFile << std::endl;
+  std::cout << "Supported formats: .xml, .3d, .obj" << std::endl;
+  exit(1);
+}
+
+Configuration parseConfig3D(std::string inputFile) {
+  Configuration config = parseConfig("scenes/default.xml");
+  ModelGroup& modelGrp = config.modelGroup;
+  modelGrp.models.clear();
+  modelGrp.subModelgroups.clear();
+  Model threeDModel = readFile(inputFile.data());
+  if (threeDModel.id == -1) {
+    std::cerr << "Error reading model file: " << inputFile << std::endl;
+    return config;
+  }
+  modelGrp.models.push_back(std::move(threeDModel));
+  return config;
+}
+
+Configuration parseConfigObj(std::string objFile) {
+  Configuration configObj = parseConfig("scenes/default.xml");
+  ModelGroup& objGroup = configObj.modelGroup;
+  objGroup.models.clear();
+  objGroup.subModelgroups.clear();
+  Model objectModel = readFile(objFile.data());
+  if (objectModel.id == -1) {
+    std::cerr << "Error reading model file: " << objFile << std::endl;
+    return configObj;
+  }
+  objGroup.models.push_back(std::move(objectModel));
+  return configObj;
+}
+
+Configuration parseConfig(std::string configFile, JobSystem* jobs) {
+  std::ifstream configStream(configFile, std::ios::binary);
+
+  std::cout << "Current directory: " << std::filesystem::current_path()
+            << std::endl;
+  std::cout << "File path: " << configFile << std::endl;
+
+  if (!configStream.is_open()) {
+    std::cerr << "Error opening the configuration file!" << std::endl;
+    exit(1);
+  }
+
+  std::cout << "Processing configuration file: " << configFile << std::endl;
+
+  // The file is streamed twice, so only the scene it describes is kept in
+  // memory. The first pass collects every file the scene refers to, which
+  // are read up front and concurrently; building the groups in the second
+  // pass then only takes meshes from the cache.
+  std::vector<std::string> modelFiles, textureFiles;
+  XmlReader scanner(configStream);
+  if (!collectFiles(scanner, modelFiles, textureFiles)) {
+    std::cerr << "Error parsing " << configFile << ", " << scanner.error()
+              << std::endl;
+    exit(1);
+  }
+  if (jobs) {
+    preloadFiles(modelFiles, textureFiles, *jobs);
+  } else {
+    JobSystem loaders;
+    preloadFiles(modelFiles, textureFiles, loaders);
+  }
+
+  configStream.clear();
+  configStream.seekg(0);
+  XmlReader reader(configStream);
+
+  // Everything the group tree allocates lives in the scene's arena
+  std::shared_ptr<SceneArena> arena = std::make_shared<SceneArena>();
+  Window displaySettings;
+  Camera camSettings;
+  std::vector<Light> lightSources;
+  ModelGroup sceneGroup(ModelGroup::allocator_type(arena.get()));
+  if (!parseWorld(reader, displaySettings, camSettings, lightSources,
+                  sceneGroup)) {
+    std::cerr << "Error parsing " << configFile << ", " << reader.error()
+              << std::endl;
+    exit(1);
+  }
+
+  Configuration config(displaySettings, camSettings, std::move(sceneGroup),
+                       std::move(lightSources));
+  config.arena = std::move(arena);
+  return config;
+}
+
+bool parseWorld(XmlReader& reader, Window& window, Camera& camera,
+                std::vector<Light>& lights, ModelGroup& sceneGroup) {
+  if (reader.next() != XML_START || reader.name() != "world") {
+    return reader.fail("the root element must be <world>");
+  }
+
+  bool hasWindow = false, hasCamera = false, hasGroup = false;
+  while (reader.nextChild(1)) {
+    std::string_view element = reader.name();
+    if (element == "window") {
+      int width, height;
+      if (!reader.attribute("width", width) ||
+          !reader.attribute("height", height)) {
+        return false;
+      }
+      window = Window(width, height);
+      hasWindow = true;
+    } else if (element == "camera") {
+      if (!parseCamera(reader, camera)) {
+        return false;
+      }
+      hasCamera = true;
+    } else if (element == "lights") {
+      if (!parseLights(reader, lights)) {
+        return false;
+      }
+    } else if (element == "group" && !hasGroup) {
+      if (!parseGroup(reader, sceneGroup)) {
+        return false;
+      }
+      hasGroup = true;
+    }
+  }
+  if (reader.failed()) {
+    return false;
+  }
+  if (!hasWindow || !hasCamera || !hasGroup) {
+    return reader.fail("<world> needs a window, a camera and a group");
+  }
+  return reader.next() == XML_EOF;
+}
+
+bool parseCamera(XmlReader& reader, Camera& camera) {
+  glm::vec3 camPosition, viewDirection, upVector;
+  float fieldOfView, nearClip, farClip;
+  int found = 0;  // One bit per required child
+
+  size_t depth = reader.depth();
+  while (reader.nextChild(depth)) {
+    std::string_view element = reader.name();
+    bool parsed = true;
+    if (element == "position") {
+      parsed = readVector(reader, "x", "y", "z", camPosition);
+      found |= 1;
+    } else if (element == "lookAt") {
+      parsed = readVector(reader, "x", "y", "z", viewDirection);
+      found |= 2;
+    } else if (element == "up") {
+      parsed = readVector(reader, "x", "y", "z", upVector);
+      found |= 4;
+    } else if (element == "projection") {
+      parsed = reader.attribute("fov", fieldOfView) &&
+               reader.attribute("near", nearClip) &&
+               reader.attribute("far", farClip);
+      found |= 8;
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  if (reader.failed()) {
+    return false;
+  }
+  if (found != 15) {
+    return reader.fail("<camera> needs a position, lookAt, up and projection");
+  }
+
+  camera = Camera(camPosition, viewDirection, upVector,
+                  static_cast<int>(fieldOfView), nearClip, farClip);
+  return true;
+}
+
+bool parseLights(XmlReader& reader, std::vector<Light>& lights) {
+  size_t depth = reader.depth();
+  while (reader.nextChild(depth)) {
+    if (reader.name() != "light" || lights.size() >= 8) {
+      continue;
+    }
+
+    const char* type;
+    if (!reader.attribute("type", type)) {
+      return false;
+    }
+    glm::vec3 position, direction;
+    switch (type[0]) {
+      case 'p': {
+        if (!readVector(reader, "posx", "posy", "posz", position)) {
+          return false;
+        }
+        lights.push_back(createPointLight(glm::vec4(position, 1)));
+      } break;
+      case 'd': {
+        if (!readVector(reader, "dirx", "diry", "dirz", direction)) {
+          return false;
+        }
+        lights.push_back(createDirectionLight(glm::vec4(direction, 1)));
+      } break;
+      case 's': {
+        float cutOff;
+        if (!readVector(reader, "posx", "posy", "posz", position) ||
+            !readVector(reader, "dirx", "diry", "dirz", direction) ||
+            !reader.attribute("cutoff", cutOff)) {
+          return false;
+        }
+        lights.push_back(createSpotLight(glm::vec4(position, 1),
+                                         glm::vec4(direction, 1), cutOff));
+      } break;
+      default:
+        break;
+    }
+  }
+  return !reader.failed();
+}
+
+bool parseGroup(XmlReader& reader, ModelGroup& sceneGroup) {
+  if (const char* name = reader.attribute("name")) {
+    sceneGroup.name = name;
+  }
+
+  size_t depth = reader.depth();
+  while (reader.nextChild(depth)) {
+    std::string_view element = reader.name();
+    bool parsed = true;
+    if (element == "transform") {
+      parsed = parseTransform(reader, sceneGroup);
+    } else if (element == "models") {
+      parsed = parseModels(reader, sceneGroup);
+    } else if (element == "instances") {
+      parsed = parseInstances(reader, sceneGroup);
+    } else if (element == "group") {
+      // Built in place, so memory only holds the groups read so far
+      ModelGroup subgroup(sceneGroup.get_allocator());
+      parsed = parseGroup(reader, subgroup);
+      sceneGroup.subModelgroups.push_back(std::move(subgroup));
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  return !reader.failed();
+}
+
+bool parseTransform(XmlReader& reader, ModelGroup& targetGroup) {
+  bool isStatic = false;
+
+  // Consecutive static transforms are folded into one matrix. The group's
+  // last one, since an earlier <transform> of the group may have added some
+  auto addStatic = [&](const glm::mat4& matrix) {
+    if (isStatic) {
+      glm::mat4& folded = targetGroup.static_transformations.back();
+      folded = folded * matrix;
+    } else {
+      targetGroup.order.push_back(STATIC);
+      targetGroup.static_transformations.push_back(matrix);
+      isStatic = true;
+    }
+  };
+
+  size_t depth = reader.depth();
+  while (reader.nextChild(depth)) {
+    std::string_view transformType = reader.name();
+    if (transformType == "scale") {
+      glm::vec3 scale;
+      if (!readVector(reader, "x", "y", "z", scale)) {
+        return false;
+      }
+      addStatic(Scalematrix(scale.x, scale.y, scale.z));
+
+    } else if (transformType == "rotate") {
+      glm::vec3 axis;
+      if (reader.attribute("time")) {
+        float rotationTime;
+        if (!reader.attribute("time", rotationTime) ||
+            !readVector(reader, "x", "y", "z", axis)) {
+          return false;
+        }
+        targetGroup.rotations.push_back(
+            TimeRotations(rotationTime, axis.x, axis.y, axis.z));
+        targetGroup.order.push_back(TIMEROTATION);
+        isStatic = false;
+
+      } else {
+        float rotationAngle;
+        if (!reader.attribute("angle", rotationAngle) ||
+            !readVector(reader, "x", "y", "z", axis)) {
+          return false;
+        }
+        addStatic(Rotationmatrix(rotationAngle, axis.x, axis.y, axis.z));
+      }
+
+    } else if (transformType == "translate") {
+      if (reader.attribute("time")) {
+        float translationTime;
+        if (!reader.attribute("time", translationTime)) {
+          return false;
+        }
+        const char* align = reader.attribute("align");
+        bool shouldAlign = !align || std::string_view(align) == "true";
+        const char* speed = reader.attribute("constantSpeed");
+        bool constantSpeed = speed && std::string_view(speed) == "true";
+
+        std::pmr::vector<Point> translationPath(targetGroup.get_allocator());
+        size_t translateDepth = reader.depth();
+        while (reader.nextChild(translateDepth)) {
+          glm::vec3 point;
+          if (reader.name() != "point") {
+            continue;
+          }
+          if (!readVector(reader, "x", "y", "z", point)) {
+            return false;
+          }
+          translationPath.push_back(Point(point.x, point.y, point.z));
+        }
+        if (reader.failed()) {
+          return false;
+        }
+        targetGroup.translates.emplace_back(translationTime, shouldAlign,
+                                            std::move(translationPath),
+                                            constantSpeed);
+        targetGroup.order.push_back(TIMETRANSLATE);
+        isStatic = false;
+
+      } else {
+        glm::vec3 translation;
+        if (!readVector(reader, "x", "y", "z", translation)) {
+          return false;
+        }
+        addStatic(
+            Translatematrix(translation.x, translation.y, translation.z));
+      }
+    }
+  }
+  return !reader.failed();
+}
+
+/**
+ * Reads the texture and color children of a model or instances element
+ */
+static bool parseAppearance(XmlReader& reader, Model& model) {
+  model.texture_filepath = "";
+
+  glm::vec4 diffuseColor = glm::vec4(0.8f, 0.8f, 0.8f, 1.0f);
+  glm::vec4 ambientColor = glm::vec4(0.2f, 0.2f, 0.2f, 1.0f);
+  glm::vec4 specularColor = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+  glm::vec4 emissiveColor = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+  float shininessValue = 0.0f;
+
+  size_t depth = reader.depth();
+  while (reader.nextChild(depth)) {
+    std::string_view element = reader.name();
+    if (element == "texture") {
+      const char* file;
+      if (!reader.attribute("file", file)) {
+        return false;
+      }
+      model.texture_filepath = file;
+      continue;
+    }
+    if (element != "color") {
+      continue;
+    }
+
+    size_t colorDepth = reader.depth();
+    while (reader.nextChild(colorDepth)) {
+      std::string_view component = reader.name();
+      bool parsed = true;
+      if (component == "diffuse") {
+        parsed = readColor(reader, diffuseColor);
+      } else if (component == "ambient") {
+        parsed = readColor(reader, ambientColor);
+      } else if (component == "specular") {
+        parsed = readColor(reader, specularColor);
+      } else if (component == "emissive") {
+        parsed = readColor(reader, emissiveColor);
+      } else if (component == "shininess") {
+        parsed = reader.attribute("value", shininessValue);
+      }
+      if (!parsed) {
+        return false;
+      }
+    }
+  }
+  if (reader.failed()) {
+    return false;
+  }
+
+  model.material = createMaterial(ambientColor, diffuseColor, specularColor,
+                                  emissiveColor, shininessValue);
+  return true;
+}
+
+/**
+ * Builds the figure of a <model procedural="..."> in memory, from the
+ * attributes named after its parameters
+ *
+ * @return False if the figure is unknown or a parameter is missing
+ */
+static bool readProceduralModel(XmlReader& reader, const std::string& shape,
+                                Model& model) {
+  const std::vector<std::string>* parameters = shapeParameters(shape);
+  if (!parameters) {
+    return reader.fail("Unknown procedural model " + shape);
+  }
+  std::vector<std::string> values;
+  for (const std::string& parameter : *parameters) {
+    const char* value;
+    if (!reader.attribute(parameter, value)) {
+      return false;
+    }
+    values.push_back(value);
+  }
+  model = buildProceduralModel(shape, values);
+  return true;
+}
+
+bool parseModels(XmlReader& reader, ModelGroup& targetGroup) {
+  size_t depth = reader.depth();
+  while (reader.nextChild(depth)) {
+    if (reader.name() != "model") {
+      continue;
+    }
+
+    Model sceneModel;
+    if (const char* shape = reader.attribute("procedural")) {
+      if (!readProceduralModel(reader, shape, sceneModel)) {
+        return false;
+      }
+    } else {
+      const char* modelFile;
+      if (!reader.attribute("file", modelFile)) {
+        return false;
+      }
+      sceneModel = readFile(modelFile);
+      if (sceneModel.id == -1) {
+        std::cerr << "Error reading model file: " << modelFile << std::endl;
+      }
+    }
+    bool loaded = sceneModel.id != -1;
+    // A model that failed to load is skipped, but its children still read
+    if (!parseAppearance(reader, sceneModel)) {
+      return false;
+    }
+    if (loaded) {
+      targetGroup.models.push_back(std::move(sceneModel));
+    }
+  }
+  return !reader.failed();
+}
+
+bool parseInstances(XmlReader& reader, ModelGroup& targetGroup) {
+  // Only model and count are required; every range defaults to one value
+  const char* modelFile;
+  InstanceDistribution distribution;
+  if (!reader.attribute("model", modelFile) ||
+      !reader.attribute("count", distribution.count) ||
+      !reader.optionalAttribute("seed", distribution.seed) ||
+      !reader.optionalAttribute("radiusMin", distribution.radiusMin) ||
+      !reader.optionalAttribute("height", distribution.height) ||
+      !reader.optionalAttribute("scaleMin", distribution.scaleMin) ||
+      !reader.optionalAttribute("periodMin", distribution.periodMin)) {
+    return false;
+  }
+  distribution.radiusMax = distribution.radiusMin;
+  distribution.scaleMax = distribution.scaleMin;
+  distribution.periodMax = distribution.periodMin;
+  if (!reader.optionalAttribute("radiusMax", distribution.radiusMax) ||
+      !reader.optionalAttribute("scaleMax", distribution.scaleMax) ||
+      !reader.optionalAttribute("periodMax", distribution.periodMax)) {
+    return false;
+  }
+  const char* rotation = reader.attribute("randomRotation");
+  distribution.randomRotation =
+      rotation && std::string_view(rotation) == "true";
+
+  Model instanceModel = readFile(modelFile);
+  bool loaded = instanceModel.id != -1;
+  if (!loaded) {
+    std::cerr << "Error reading model file: " << modelFile << std::endl;
+  }
+  if (!parseAppearance(reader, instanceModel)) {
+    return false;
+  }
+  if (loaded) {
+    targetGroup.instances.emplace_back(std::move(instanceModel),
+                                       distribution);
+  }
+  return true;
+}
@@ -0,0 +1,17 @@
+#include "frameClock.hpp"
+
+FrameClock::FrameClock() { this->_last = std::chrono::steady_clock::now(); }
+
+void FrameClock::tick() {
+  const auto now = std::chrono::steady_clock::now();
+  this->_delta = std::chrono::duration<float>(now - this->_last).count();
+  this->_last = now;
+  this->_frame++;
+
+  if (this->_paused) {
+    return;
+  }
+
+  double step = this->_fixedStep > 0.0 ? this->_fixedStep : this->_delta;
+  this->_time += step * this->_scale;
+}
@@ -0,0 +1,27 @@
+#include "framePacket.hpp"
+
+void captureFrame(const SceneGraph& graph, double time, FramePacket& packet) {
+  packet.time = time;
+  packet.world.assign(graph.world.begin(), graph.world.end());
+
+  packet.instances.resize(graph.instance_sets.size());
+  for (size_t i = 0; i < graph.instance_sets.size(); i++) {
+    const std::vector<glm::mat4>& matrices = graph.instance_sets[i]->matrices();
+    packet.instances[i].assign(matrices.begin(), matrices.end());
+  }
+}
+
+void cullFrame(const BVH& bvh, const Frustum& frustum, FramePacket& packet) {
+  packet.culled = true;
+  bvh.queryFrustum(frustum, packet.visible, packet.visible_instances);
+
+  // The visible indices are ascending, so the matrices compact in place
+  for (size_t i = 0; i < packet.instances.size(); i++) {
+    std::vector<glm::mat4>& matrices = packet.instances[i];
+    const std::vector<int>& visible = packet.visible_instances[i];
+    for (size_t k = 0; k < visible.size(); k++) {
+      matrices[k] = matrices[visible[k]];
+    }
+    matrices.resize(visible.size());
+  }
+}
@@ -0,0 +1,98 @@
+#include "instanceSet.hpp"
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <utility>
+
+#include "catmullCurves.hpp"
+#include "simd.hpp"
+
+using simd::Float;
+
+/**
+ * Uniform float in [0, 1). Unlike std::uniform_real_distribution, the same
+ * seed gives the same scene with every standard library.
+ */
+static float uniform(std::mt19937& rng) {
+  return static_cast<float>(rng() >> 8) * (1.0f / 16777216.0f);
+}
+
+static float mix(float a, float b, float t) { return a + (b - a) * t; }
+
+InstanceSet::InstanceSet(Model model, const InstanceDistribution& distribution)
+    : model(std::move(model)) {
+  size_t count = std::max(distribution.count, 0);
+  size_t padded = (count + simd::WIDTH - 1) / simd::WIDTH * simd::WIDTH;
+  _radius.assign(padded, 0.0f);
+  _height.assign(padded, 0.0f);
+  _phase.assign(padded, 0.0f);
+  _turnRate.assign(padded, 0.0);
+  _shape.reserve(count);
+  _matrices.assign(count, glm::mat4(1.0f));
+
+  std::mt19937 rng(distribution.seed);
+  for (size_t i = 0; i < count; i++) {
+    _radius[i] =
+        mix(distribution.radiusMin, distribution.radiusMax, uniform(rng));
+    _height[i] = distribution.height * (2.0f * uniform(rng) - 1.0f);
+    _phase[i] = uniform(rng);
+    float period =
+        mix(distribution.periodMin, distribution.periodMax, uniform(rng));
+    _turnRate[i] = period > 0.0f ? 1.0 / period : 0.0;
+
+    float scale =
+        mix(distribution.scaleMin, distribution.scaleMax, uniform(rng));
+    glm::mat4 shape = Scalematrix(scale, scale, scale);
+    if (distribution.randomRotation) {
+      // Axis uniform on the sphere, any angle around it
+      float z = 2.0f * uniform(rng) - 1.0f;
+      float azimuth = 2.0f * static_cast<float>(M_PI) * uniform(rng);
+      float ring = std::sqrt(1.0f - z * z);
+      shape = Rotationmatrix(360.0f * uniform(rng), ring * std::cos(azimuth),
+                             ring * std::sin(azimuth), z) *
+              shape;
+    }
+    _shape.push_back(shape);
+  }
+}
+
+void InstanceSet::update(double elapsed_time) {
+  if (_valid && elapsed_time == _time) {
+    return;
+  }
+
+  alignas(64) float x[simd::WIDTH], z[simd::WIDTH];
+  alignas(64) float fraction[simd::WIDTH];
+  for (size_t first = 0; first < size(); first += simd::WIDTH) {
+    // Turns in double, wrapped to one before converting, so the orbits
+    // don't step as the animation time grows
+    for (size_t lane = 0; lane < simd::WIDTH; lane++) {
+      double turns =
+          _turnRate[first + lane] * elapsed_time + _phase[first + lane];
+      fraction[lane] = static_cast<float>(turns - std::floor(turns));
+    }
+    Float angle = simd::load(fraction) *
+                  simd::broadcast(2.0f * static_cast<float>(M_PI));
+    Float sine, cosine;
+    simd::sincos(angle, sine, cosine);
+
+    // Same direction as a positive rotation about Y
+    Float radius = simd::load(&_radius[first]);
+    simd::store(x, radius * cosine);
+    simd::store(z, simd::negate(radius * sine));
+
+    size_t lanes = std::min<size_t>(simd::WIDTH, size() - first);
+    for (size_t lane = 0; lane < lanes; lane++) {
+      size_t i = first + lane;
+      _matrices[i] = _shape[i];
+      _matrices[i][3] = glm::vec4(x[lane], _height[i], z[lane], 1.0f);
+    }
+  }
+
+  _valid = true;
+  _time = elapsed_time;
+}
@@ -0,0 +1,114 @@
+#include "jobSystem.hpp"
+
+#include <algorithm>
+
+JobSystem::JobSystem(unsigned threads) {
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  // The calling thread also executes work, so spawn one worker less
+  for (unsigned i = 0; i < threads; i++) {
+    _queues.push_back(std::make_unique<Queue>());
+  }
+  for (unsigned i = 1; i < threads; i++) {
+    _threads.emplace_back(&JobSystem::workerLoop, this, i);
+  }
+}
+
+JobSystem::~JobSystem() {
+  {
+    std::lock_guard<std::mutex> lock(_sleepMutex);
+    _stop = true;
+  }
+  _wake.notify_all();
+  for (std::thread& thread : _threads) {
+    thread.join();
+  }
+}
+
+void JobSystem::parallelFor(size_t count, size_t grain,
+                            const std::function<void(size_t, size_t)>& fn) {
+  if (count == 0) {
+    return;
+  }
+  grain = std::max<size_t>(grain, 1);
+  if (_threads.empty() || count <= grain) {
+    fn(0, count);
+    return;
+  }
+
+  size_t chunks = (count + grain - 1) / grain;
+  std::atomic<size_t> remaining{chunks};
+
+  // Deal the chunks round-robin so every worker starts with local work
+  for (size_t chunk = 0; chunk < chunks; chunk++) {
+    size_t begin = chunk * grain;
+    Task task = {&fn, begin, std::min(begin + grain, count), &remaining};
+    Queue& queue = *_queues[chunk % _queues.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.push_back(task);
+  }
+  {
+    std::lock_guard<std::mutex> lock(_sleepMutex);
+    _pending.fetch_add(chunks);
+  }
+  _wake.notify_all();
+
+  // Help until every chunk, including the ones stolen by workers, finished
+  Task task;
+  while (remaining.load(std::memory_order_acquire) > 0) {
+    if (popTask(0, task)) {
+      execute(task);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void JobSystem::workerLoop(size_t self) {
+  Task task;
+  while (true) {
+    if (popTask(self, task)) {
+      execute(task);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(_sleepMutex);
+    _wake.wait(lock, [this] { return _stop || _pending.load() > 0; });
+    if (_stop) {
+      return;
+    }
+  }
+}
+
+bool JobSystem::popTask(size_t self, Task& task) {
+  // Own queue first, newest task (still warm in cache)
+  {
+    Queue& own = *_queues[self];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (!own.tasks.empty()) {
+      task = own.tasks.back();
+      own.tasks.pop_back();
+      return true;
+    }
+  }
+
+  // Otherwise steal the oldest task of another queue
+  for (size_t i = 1; i < _queues.size(); i++) {
+    Queue& victim = *_queues[(self + i) % _queues.size()];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      task = victim.tasks.front();
+      victim.tasks.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+void JobSystem::execute(Task& task) {
+  _pending.fetch_sub(1);
+  (*task.fn)(task.begin, task.end);
+  task.remaining->fetch_sub(1, std::memory_order_release);
+}
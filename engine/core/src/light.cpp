@@ -0,0 +1,36 @@
+#include "light.hpp"
+
+Light createDirectionLight(glm::vec4 direction) {
+  Light light;
+  light.type = DIRECTIONAL;
+  light.direction = direction;
+  return light;
+}
+
+Light createPointLight(glm::vec4 position) {
+  Light light;
+  light.type = POINT;
+  light.position = position;
+  return light;
+}
+
+Light createSpotLight(glm::vec4 position, glm::vec4 direction, float cutoff) {
+  Light light;
+  light.type = SPOT;
+  light.position = position;
+  light.direction = direction;
+  light.cutoff = cutoff;
+  return light;
+}
+
+Material createMaterial(glm::vec4 ambient, glm::vec4 diffuse,
+                        glm::vec4 specular, glm::vec4 emission,
+                        float shininess) {
+  Material material;
+  material.ambient = ambient;
+  material.diffuse = diffuse;
+  material.specular = specular;
+  material.emission = emission;
+  material.shininess = shininess;
+  return material;
+}
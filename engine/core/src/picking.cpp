@@ -0,0 +1,165 @@
+#include "picking.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "simd.hpp"
+
+using simd::Float;
+
+// Floats from one vertex of Mesh::vbo to the next
+static const int VERTEX_STRIDE = sizeof(Vertex) / sizeof(float);
+static_assert(sizeof(Vertex) % sizeof(float) == 0,
+              "Vertex must be made of floats only");
+
+// Near-parallel triangles are skipped; barycentric bounds are widened
+// slightly so rays through a shared edge hit one of its triangles
+static const float DETERMINANT_EPSILON = 1e-12f;
+static const float EDGE_EPSILON = 1e-6f;
+
+Ray cursorRay(const glm::mat4& viewProjection, glm::vec2 cursor,
+              glm::vec2 viewport) {
+  // Center of the pixel, in normalized device coordinates
+  glm::vec2 ndc(2.0f * (cursor.x + 0.5f) / viewport.x - 1.0f,
+                1.0f - 2.0f * (cursor.y + 0.5f) / viewport.y);
+
+  glm::mat4 inverse = glm::inverse(viewProjection);
+  glm::vec4 near = inverse * glm::vec4(ndc.x, ndc.y, -1.0f, 1.0f);
+  glm::vec4 far = inverse * glm::vec4(ndc.x, ndc.y, 1.0f, 1.0f);
+  glm::vec3 origin = glm::vec3(near) / near.w;
+  return {origin, glm::normalize(glm::vec3(far) / far.w - origin)};
+}
+
+int intersectMesh(const Mesh& mesh, const Ray& ray, float& distance) {
+  size_t triangles = mesh.ibo.size() / 3;
+  if (triangles == 0) return -1;
+
+  const float* positions = &mesh.vbo[0].position.x;
+  const Float zero = simd::broadcast(0.0f);
+  const Float one = simd::broadcast(1.0f + EDGE_EPSILON);
+  const Float edge = simd::broadcast(-EDGE_EPSILON);
+  const Float epsilon = simd::broadcast(DETERMINANT_EPSILON);
+  const Float o[3] = {simd::broadcast(ray.origin.x),
+                      simd::broadcast(ray.origin.y),
+                      simd::broadcast(ray.origin.z)};
+  const Float d[3] = {simd::broadcast(ray.direction.x),
+                      simd::broadcast(ray.direction.y),
+                      simd::broadcast(ray.direction.z)};
+
+  Float best = simd::broadcast(distance);
+  Float bestTriangle = simd::broadcast(-1.0f);
+
+  // Vertex offsets go through float lanes for the gathers, which is exact
+  // for meshes of up to 2^24 / VERTEX_STRIDE vertices
+  alignas(64) float offsets[3][simd::WIDTH];
+  alignas(64) float ids[simd::WIDTH];
+  for (size_t first = 0; first < triangles; first += simd::WIDTH) {
+    // Lanes past the last triangle repeat it
+    for (int lane = 0; lane < simd::WIDTH; lane++) {
+      size_t triangle = std::min(first + lane, triangles - 1);
+      for (int corner = 0; corner < 3; corner++) {
+        offsets[corner][lane] = static_cast<float>(
+            mesh.ibo[triangle * 3 + corner] * VERTEX_STRIDE);
+      }
+      ids[lane] = static_cast<float>(triangle);
+    }
+
+    Float v0[3], e1[3], e2[3];
+    Float offset0 = simd::load(offsets[0]), offset1 = simd::load(offsets[1]),
+          offset2 = simd::load(offsets[2]);
+    for (int axis = 0; axis < 3; axis++) {
+      v0[axis] = simd::gather(positions + axis, offset0);
+      e1[axis] = simd::gather(positions + axis, offset1) - v0[axis];
+      e2[axis] = simd::gather(positions + axis, offset2) - v0[axis];
+    }
+
+    // p = d x e2, s = o - v0, q = s x e1
+    Float p[3] = {d[1] * e2[2] - d[2] * e2[1], d[2] * e2[0] - d[0] * e2[2],
+                  d[0] * e2[1] - d[1] * e2[0]};
+    Float determinant = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+    Float inverse = simd::broadcast(1.0f) / determinant;
+
+    Float s[3] = {o[0] - v0[0], o[1] - v0[1], o[2] - v0[2]};
+    Float u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * inverse;
+    Float q[3] = {s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2],
+                  s[0] * e1[1] - s[1] * e1[0]};
+    Float v = (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]) * inverse;
+    Float t = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * inverse;
+
+    // Both windings count, so the determinant may have either sign
+    Float magnitude =
+        simd::select(determinant < zero, simd::negate(determinant),
+                     determinant);
+    simd::Mask hit = (magnitude > epsilon) & (u > edge) & (v > edge) &
+                     ((u + v) < one) & (t > zero) & (t < best);
+    best = simd::select(hit, t, best);
+    bestTriangle = simd::select(hit, simd::load(ids), bestTriangle);
+  }
+
+  // Closest hit across the lanes
+  alignas(64) float laneDistance[simd::WIDTH];
+  alignas(64) float laneTriangle[simd::WIDTH];
+  simd::store(laneDistance, best);
+  simd::store(laneTriangle, bestTriangle);
+  int result = -1;
+  for (int lane = 0; lane < simd::WIDTH; lane++) {
+    if (laneTriangle[lane] >= 0.0f && laneDistance[lane] < distance) {
+      distance = laneDistance[lane];
+      result = static_cast<int>(laneTriangle[lane]);
+    }
+  }
+  return result;
+}
+
+PickResult pick(const SceneGraph& graph, const BVH& bvh, const Ray& ray) {
+  PickResult result;
+  float closest = std::numeric_limits<float>::infinity();
+
+  std::vector<std::pair<float, int>> candidates;
+  bvh.queryRay(ray.origin, ray.direction, candidates);
+  for (auto [entry, item] : candidates) {
+    if (entry >= closest) break;
+
+    PickResult candidate;
+    if (bvh.isInstance(item)) {
+      BVH::InstanceRef ref = bvh.instance(item);
+      candidate.set = ref.set;
+      candidate.instance = ref.instance;
+    } else {
+      candidate.model = item;
+    }
+    const Mesh& mesh =
+        candidate.model >= 0
+            ? *graph.models[candidate.model]->mesh
+            : *graph.instance_sets[candidate.set]->model.mesh;
+
+    // Affine transforms keep the ray parameter, so the model-space distance
+    // is the world-space one
+    glm::mat4 toModel = glm::inverse(pickedWorld(graph, candidate));
+    Ray local = {glm::vec3(toModel * glm::vec4(ray.origin, 1.0f)),
+                 glm::vec3(toModel * glm::vec4(ray.direction, 0.0f))};
+
+    float distance = closest;
+    int triangle = intersectMesh(mesh, local, distance);
+    if (triangle >= 0) {
+      closest = distance;
+      candidate.triangle = triangle;
+      candidate.distance = distance;
+      result = candidate;
+    }
+  }
+  return result;
+}
+
+glm::mat4 pickedWorld(const SceneGraph& graph, const PickResult& result) {
+  if (result.model >= 0) {
+    return graph.world[graph.model_node[result.model]];
+  }
+  if (result.set >= 0) {
+    return graph.world[graph.instance_node[result.set]] *
+           graph.instance_sets[result.set]->matrices()[result.instance];
+  }
+  return glm::mat4(1.0f);
+}
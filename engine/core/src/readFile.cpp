@@ -0,0 +1,417 @@
+#include "readFile.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Model.hpp"
+#include "jobSystem.hpp"
+#include "shapeBuilder.hpp"
+
+// Textures are decoded here, so the renderer only uploads pixels
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image/stb_image.h"
+
+// Models already read, by path, or built, by figure and parameters. Copies
+// share the cached mesh
+static std::unordered_map<std::string, Model> hash_models;
+// Decoded textures, by path
+static std::unordered_map<std::string, std::shared_ptr<const TextureImage>>
+    hash_textures;
+// Guards both caches, which preloadFiles fills from several threads
+static std::mutex cache_mutex;
+
+Model readOBJfile(const char* filepath) {
+  std::vector<Point> points;
+  std::vector<Point> normals;
+  std::vector<Point2D> textures;
+  std::vector<Vertex> vertices;
+  std::ifstream file(filepath);
+
+  if (!file.is_open()) {
+    std::cerr << "Error opening file: " << filepath << std::endl;
+    return Model();  // Return an empty model or handle the error as appropriate
+  }
+
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream iss(line);
+    std::string type;
+    iss >> type;
+    if (type == "v") {
+      Point point;
+      iss >> point.x >> point.y >> point.z;
+      points.push_back(point);
+    } else if (type == "vn") {
+      Point normal;
+      iss >> normal.x >> normal.y >> normal.z;
+      normals.push_back(normal);
+    } else if (type == "vt") {
+      Point2D texture;
+      iss >> texture.x >> texture.y;
+      textures.push_back(texture);
+    } else if (type == "f") {
+      std::string vertex;
+
+      while (iss >> vertex) {
+        std::istringstream index_stream(vertex);
+        std::string index_str;
+        std::vector<int> indices;
+        while (std::getline(index_stream, index_str, '/')) {
+          if (!index_str.empty())
+            indices.push_back(std::stoi(index_str) - 1);
+          else
+            indices.push_back(-1);  // If texture or normal index is missing
+        }
+        int point_index = indices[0];
+        int texture_index = indices[1];
+        int normal_index = indices[2];
+        float x, y, z, nx, ny, nz, tx, ty;
+        x = points[point_index].x;
+        y = points[point_index].y;
+        z = points[point_index].z;
+        nx = normals[normal_index].x;
+        ny = normals[normal_index].y;
+        nz = normals[normal_index].z;
+        if (texture_index == -1) {
+          tx = 0;
+          ty = 0;
+        } else {
+          tx = textures[texture_index].x;
+          ty = textures[texture_index].y;
+        }
+
+        if (texture_index == -1) {
+          printf("Texture index is -1\n");
+        }
+        if (normal_index == -1) {
+          printf("Normal index is -1\n");
+        }
+        if (texture_index > textures.size()) {
+          printf("Texture index is out of bounds\n");
+        }
+        if (normal_index > normals.size()) {
+          printf("Normal index is out of bounds\n");
+        }
+
+        vertices.push_back(Vertex(x, y, z, nx, ny, nz, tx, ty));
+      }
+    }
+  }
+
+  file.close();
+
+  Model model(filepath, std::move(vertices));
+  return model;
+}
+
+Model read3DAdvancedFile(const char* filepath) {
+  std::ifstream file(filepath);
+
+  std::vector<Vertex> points;
+
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream iss(line);
+    char type;
+    float x, y, z, nx, ny, nz, tx, ty;
+    if (iss >> type >> x >> y >> z >> nx >> ny >> nz >> tx >> ty) {
+      points.push_back(Vertex(x, y, z, nx, ny, nz, tx, ty));
+    }
+  }
+
+  // printing info
+  std::cout << "Points: " << points.size() << std::endl;
+  std::cout << "Normals: " << points.size() << std::endl;
+  std::cout << "Textures: " << points.size() << std::endl;
+  Model model(filepath, std::move(points));
+  return model;
+}
+
+Model read3DSimpleFile(const char* filepath) {
+  std::ifstream file(filepath);
+
+  std::vector<Vertex> points;
+
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream iss(line);
+    char type;
+    float x, y, z, nx, ny, nz, tx, ty;
+    if (iss >> type >> x >> y >> z) {
+      points.push_back(Vertex(Point(x, y, z)));
+    }
+  }
+
+  Model model(filepath, std::move(points));
+  return model;
+}
+
+/**
+ * Reads the indexed .3d format written by the generator: a "# indexed
+ * <vertices> <triangles>" header, then the "v" and "f" lines, in any order
+ * when the file was streamed. The vertices are already shared, so they go
+ * into the model as they are.
+ */
+Model read3DIndexedFile(const char* filepath, std::ifstream& file) {
+  size_t vertexCount, triangleCount;
+  if (!(file >> vertexCount >> triangleCount)) {
+    std::cerr << "Error reading header of " << filepath << std::endl;
+    return Model();
+  }
+
+  std::vector<Vertex> vbo;
+  vbo.reserve(vertexCount);
+  std::vector<unsigned int> ibo;
+  ibo.reserve(triangleCount * 3);
+  char type;
+  float x, y, z, nx, ny, nz, tx, ty;
+  unsigned int a, b, c;
+  for (size_t line = 0; line < vertexCount + triangleCount; line++) {
+    if (!(file >> type)) {
+      break;
+    }
+    if (type == 'v' && vbo.size() < vertexCount &&
+        file >> x >> y >> z >> nx >> ny >> nz >> tx >> ty) {
+      vbo.push_back(Vertex(x, y, z, nx, ny, nz, tx, ty));
+    } else if (type == 'f' && ibo.size() < triangleCount * 3 &&
+               file >> a >> b >> c) {
+      ibo.insert(ibo.end(), {a, b, c});
+    } else {
+      break;
+    }
+  }
+
+  if (vbo.size() != vertexCount || ibo.size() != triangleCount * 3) {
+    std::cerr << "Error reading " << filepath << ": expected " << vertexCount
+              << " vertices and " << triangleCount << " triangles, read "
+              << vbo.size() << " and " << ibo.size() / 3 << std::endl;
+    return Model();
+  }
+  if (!ibo.empty() && *std::max_element(ibo.begin(), ibo.end()) >= vbo.size()) {
+    std::cerr << "A triangle of " << filepath << " uses a vertex out of range"
+              << std::endl;
+    return Model();
+  }
+
+  std::cout << "Vertices: " << vbo.size() << std::endl;
+  std::cout << "Triangles: " << triangleCount << std::endl;
+  return Model(filepath, std::move(vbo), std::move(ibo));
+}
+
+Model read3DFile(const char* filepath) {
+  std::ifstream file(filepath);
+
+  char type;
+  if (file >> type) {
+    if (type != '#') {
+      return read3DSimpleFile(filepath);
+    }
+
+    // "# <count>" starts a triangle list, "# indexed" an indexed mesh
+    std::string format;
+    if (file >> format && format == "indexed") {
+      return read3DIndexedFile(filepath, file);
+    }
+    return read3DAdvancedFile(filepath);
+  }
+
+  return Model();
+}
+
+/**
+ * Path of a model file as the scenes refer to it: relative to models/
+ */
+static std::string modelPath(const char* filepath) {
+  std::string path(filepath);
+  if (path.find("models/") != 0) {
+    path = "models/" + path;
+  }
+  return path;
+}
+
+Model readFile(const char* filepath) {
+  std::string path = modelPath(filepath);
+  // printing the path
+  std::cout << "Path: " << path << std::endl;
+
+  // Verifica se o modelo já foi lido
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto cached = hash_models.find(path);
+    if (cached != hash_models.end()) {
+      std::cout << path << " already read." << std::endl;
+      return cached->second;
+    }
+  }
+
+  std::ifstream file(path.c_str());
+  if (!file.is_open()) {
+    std::cerr << "Error opening file" << std::endl;
+    return Model();
+  }
+
+  // Lê o arquivo com base na sua extensão
+  Model model;
+  if (std::filesystem::path(path).extension() == ".3d") {
+    model = read3DFile(path.c_str());
+  } else if (std::filesystem::path(path).extension() == ".obj") {
+    model = readOBJfile(path.c_str());
+  } else {
+    // Se o tipo do arquivo não for reconhecido
+    std::cerr << "Unsupported file type" << std::endl;
+    return Model();
+  }
+
+  if (model.id != -1) {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    hash_models.emplace(path, model);
+  }
+  return model;
+}
+
+/**
+ * A parameter as it goes in the key of a procedural model: numbers in their
+ * shortest form, so that "1" and "1.0" give the same model
+ */
+static std::string canonicalValue(const std::string& value) {
+  char* end;
+  float number = std::strtof(value.c_str(), &end);
+  if (value.empty() || *end != '\0') {
+    return value;
+  }
+  char text[32];
+  char* textEnd = std::to_chars(text, text + sizeof(text), number).ptr;
+  return std::string(text, textEnd);
+}
+
+Model buildProceduralModel(const std::string& shape,
+                           const std::vector<std::string>& values) {
+  std::vector<std::string> parameters = values;
+  if ((shape == "patch" || shape == "adaptivepatch") && !parameters.empty()) {
+    parameters[0] = modelPath(parameters[0].c_str());
+  }
+
+  std::string key = "procedural:" + shape;
+  for (const std::string& value : parameters) {
+    key += ' ' + canonicalValue(value);
+  }
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto cached = hash_models.find(key);
+    if (cached != hash_models.end()) {
+      return cached->second;
+    }
+  }
+
+  IndexedMesh mesh;
+  if (!buildShape(shape, parameters, mesh)) {
+    std::cerr << "Error building " << key << std::endl;
+    return Model();
+  }
+  std::vector<Vertex> vbo;
+  vbo.reserve(mesh.vertexCount());
+  for (size_t i = 0; i < mesh.vertexCount(); i++) {
+    const Point& point = mesh.points[i];
+    const Point& normal = mesh.normals[i];
+    vbo.push_back(Vertex(point.x, point.y, point.z, normal.x, normal.y,
+                         normal.z, mesh.textures[i].x, mesh.textures[i].y));
+  }
+  std::cout << key << ": " << vbo.size() << " vertices, "
+            << mesh.triangleCount() << " triangles" << std::endl;
+
+  Model model(key, std::move(vbo), std::move(mesh.indices));
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  return hash_models.emplace(key, std::move(model)).first->second;
+}
+
+TextureImage::~TextureImage() {
+  if (pixels) {
+    stbi_image_free(pixels);
+  }
+}
+
+std::shared_ptr<const TextureImage> readTexture(const std::string& filepath) {
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto cached = hash_textures.find(filepath);
+    if (cached != hash_textures.end()) {
+      return cached->second;
+    }
+  }
+
+  auto image = std::make_shared<TextureImage>();
+  int channels;
+  image->pixels = stbi_load(filepath.c_str(), &image->width, &image->height,
+                            &channels, STBI_rgb_alpha);
+  if (!image->pixels) {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  return hash_textures.emplace(filepath, std::move(image)).first->second;
+}
+
+void releaseModels() {
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  hash_models.clear();
+}
+
+void releaseTextures() {
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  hash_textures.clear();
+}
+
+void preloadFiles(const std::vector<std::string>& models,
+                  const std::vector<std::string>& textures, JobSystem& jobs) {
+  auto start = std::chrono::steady_clock::now();
+
+  // One entry per file still to read, models first
+  std::vector<std::string> files;
+  size_t modelCount;
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    std::set<std::string> unique;
+    for (const std::string& model : models) {
+      std::string path = modelPath(model.c_str());
+      if (!hash_models.count(path) && unique.insert(path).second) {
+        files.push_back(std::move(path));
+      }
+    }
+    modelCount = files.size();
+    for (const std::string& texture : textures) {
+      if (!hash_textures.count(texture) && unique.insert(texture).second) {
+        files.push_back(texture);
+      }
+    }
+  }
+
+  // Loading is mostly parsing and decoding, so one file per job
+  jobs.parallelFor(files.size(), 1, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; i++) {
+      if (i < modelCount) {
+        readFile(files[i].c_str());
+      } else {
+        readTexture(files[i]);
+      }
+    }
+  });
+
+  std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+  std::cout << "Loaded " << modelCount << " models and "
+            << files.size() - modelCount << " textures in " << elapsed.count()
+            << " ms" << std::endl;
+}
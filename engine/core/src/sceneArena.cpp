@@ -0,0 +1,37 @@
+#include "sceneArena.hpp"
+
+// First heap block; the pool grows geometrically from here
+static const size_t INITIAL_BLOCK = 64 * 1024;
+
+SceneArena::SceneArena() : _pool(INITIAL_BLOCK, &_upstream) {}
+
+void* SceneArena::do_allocate(size_t bytes, size_t alignment) {
+  _allocations++;
+  _bytesRequested += bytes;
+  return _pool.allocate(bytes, alignment);
+}
+
+void SceneArena::do_deallocate(void*, size_t, size_t) {
+  // Memory is only returned when the whole arena goes away
+}
+
+bool SceneArena::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+void* SceneArena::Upstream::do_allocate(size_t bytes, size_t alignment) {
+  blocks++;
+  this->bytes += bytes;
+  return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+void SceneArena::Upstream::do_deallocate(void* p, size_t bytes,
+                                         size_t alignment) {
+  std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+}
+
+bool SceneArena::Upstream::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
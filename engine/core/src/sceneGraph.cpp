@@ -0,0 +1,215 @@
+#include "sceneGraph.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <utility>
+
+// Nodes per job when a level is evaluated in parallel
+static const size_t UPDATE_GRAIN = 512;
+// Tracks per job, a multiple of every SIMD width
+static const size_t TRACK_GRAIN = 1024;
+
+void SceneGraph::clear() {
+  parent.clear();
+  op_begin.clear();
+  op_count.clear();
+  model_begin.clear();
+  model_count.clear();
+  local.clear();
+  world.clear();
+  animated.clear();
+  groups.clear();
+  level_begin.clear();
+  op_type.clear();
+  op_index.clear();
+  static_matrices.clear();
+  rotations.clear();
+  translations.clear();
+  tracks.clear();
+  rotation_matrices.clear();
+  translation_matrices.clear();
+  models.clear();
+  model_node.clear();
+  instance_sets.clear();
+  instance_node.clear();
+  _changed.clear();
+  _valid = false;
+}
+
+/**
+ * Flattens the group tree breadth-first into the node arrays
+ */
+void SceneGraph::build(ModelGroup& root) {
+  clear();
+
+  std::deque<std::pair<ModelGroup*, int>> pending = {{&root, -1}};
+  int levelEnd = 0;
+  while (!pending.empty()) {
+    auto [group, parentNode] = pending.front();
+    pending.pop_front();
+    int node = static_cast<int>(parent.size());
+
+    // Breadth-first order: a level ends where the children of the last node
+    // of the previous level start
+    if (node == levelEnd) {
+      level_begin.push_back(node);
+      levelEnd = node + static_cast<int>(pending.size()) + 1;
+    }
+
+    parent.push_back(parentNode);
+    groups.push_back(group);
+
+    // Transform steps keep their order; each one indexes its own array
+    op_begin.push_back(static_cast<int>(op_type.size()));
+    op_count.push_back(static_cast<int>(group->order.size()));
+    int s = 0, r = 0, t = 0;
+    animated.push_back(!group->rotations.empty() ||
+                       !group->translates.empty());
+    for (Transformations type : group->order) {
+      op_type.push_back(type);
+      switch (type) {
+        case STATIC:
+          op_index.push_back(static_cast<int>(static_matrices.size()));
+          static_matrices.push_back(group->static_transformations[s++]);
+          break;
+        case TIMEROTATION:
+          op_index.push_back(static_cast<int>(rotations.size()));
+          rotations.push_back(group->rotations[r++]);
+          break;
+        case TIMETRANSLATE:
+          op_index.push_back(static_cast<int>(translations.size()));
+          translations.push_back(group->translates[t++]);
+          break;
+      }
+    }
+
+    model_begin.push_back(static_cast<int>(models.size()));
+    model_count.push_back(static_cast<int>(group->models.size()));
+    for (Model& model : group->models) {
+      models.push_back(&model);
+      model_node.push_back(node);
+    }
+    for (InstanceSet& set : group->instances) {
+      instance_sets.push_back(&set);
+      instance_node.push_back(node);
+    }
+
+    for (ModelGroup& child : group->subModelgroups) {
+      pending.emplace_back(&child, node);
+    }
+  }
+
+  level_begin.push_back(static_cast<int>(parent.size()));
+
+  local.assign(parent.size(), glm::mat4(1.0f));
+  world.assign(parent.size(), glm::mat4(1.0f));
+  _changed.assign(parent.size(), 0);
+
+  tracks.build(rotations, translations);
+  rotation_matrices.assign(rotations.size(), glm::mat4(1.0f));
+  translation_matrices.assign(translations.size(), glm::mat4(1.0f));
+}
+
+glm::mat4 SceneGraph::localMatrix(int node) {
+  glm::mat4 matrix = glm::mat4(1.0f);
+
+  int end = op_begin[node] + op_count[node];
+  for (int op = op_begin[node]; op < end; op++) {
+    int index = op_index[op];
+    switch (op_type[op]) {
+      case TIMEROTATION:
+        matrix *= rotation_matrices[index];
+        break;
+      case TIMETRANSLATE:
+        matrix *= translation_matrices[index];
+        break;
+      case STATIC:
+        matrix *= static_matrices[index];
+        break;
+    }
+  }
+
+  return matrix;
+}
+
+/**
+ * Updates the nodes in [begin, end), whose parents are already up to date
+ *
+ * @return Number of world matrices recomputed
+ */
+int SceneGraph::updateRange(size_t begin, size_t end, bool timeChanged) {
+  int recomputed = 0;
+  for (size_t node = begin; node < end; node++) {
+    bool dirty = !_valid;
+    if (!_valid || (animated[node] && timeChanged)) {
+      local[node] = localMatrix(node);
+      dirty = true;
+    }
+
+    int p = parent[node];
+    if (p >= 0 && _changed[p]) {
+      dirty = true;
+    }
+
+    if (dirty) {
+      world[node] = p < 0 ? local[node] : world[p] * local[node];
+      recomputed++;
+    }
+    _changed[node] = dirty;
+  }
+  return recomputed;
+}
+
+/**
+ * Evaluates every timed rotation and translation at the given time
+ */
+void SceneGraph::updateTracks(float elapsed_time) {
+  auto evaluate = [&](size_t first, size_t last) {
+    tracks.evaluateRotations(elapsed_time, first,
+                             std::min(last, tracks.rotationCount()),
+                             rotation_matrices.data());
+    tracks.evaluateTranslations(elapsed_time, first,
+                                std::min(last, tracks.translationCount()),
+                                translation_matrices.data());
+  };
+
+  size_t count = std::max(tracks.rotationCount(), tracks.translationCount());
+  if (!_jobs || count <= TRACK_GRAIN) {
+    evaluate(0, count);
+  } else {
+    _jobs->parallelFor(count, TRACK_GRAIN, evaluate);
+  }
+}
+
+void SceneGraph::update(double elapsed_time, FrameStats& stats) {
+  // Animated nodes only change when the time does (e.g. not while paused)
+  bool timeChanged = !_valid || elapsed_time != _time;
+  if (timeChanged) {
+    updateTracks(static_cast<float>(elapsed_time));
+    for (InstanceSet* set : instance_sets) {
+      set->update(elapsed_time);
+    }
+  }
+
+  // Levels run in order; the nodes inside a level are independent
+  for (size_t level = 0; level + 1 < level_begin.size(); level++) {
+    size_t begin = level_begin[level];
+    size_t count = level_begin[level + 1] - begin;
+
+    if (!_jobs || count <= UPDATE_GRAIN) {
+      stats.matrices_recomputed +=
+          updateRange(begin, begin + count, timeChanged);
+      continue;
+    }
+
+    std::atomic<int> recomputed{0};
+    _jobs->parallelFor(count, UPDATE_GRAIN, [&](size_t first, size_t last) {
+      recomputed += updateRange(begin + first, begin + last, timeChanged);
+    });
+    stats.matrices_recomputed += recomputed.load();
+  }
+
+  _valid = true;
+  _time = elapsed_time;
+}
@@ -0,0 +1,448 @@
+#include "xmlReader.hpp"
+
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+
+static bool isSpace(int c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static bool isNameStart(int c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' ||
+         c == ':' || c >= 0x80;
+}
+
+static bool isNameChar(int c) {
+  return isNameStart(c) || (c >= '0' && c <= '9') || c == '-' || c == '.';
+}
+
+static void appendUtf8(std::string& out, unsigned long code) {
+  if (code < 0x80) {
+    out.push_back(static_cast<char>(code));
+  } else if (code < 0x800) {
+    out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+    out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+  } else if (code < 0x10000) {
+    out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+    out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+  } else {
+    out.push_back(static_cast<char>(0xF0 | (code >> 18)));
+    out.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+  }
+}
+
+XmlReader::XmlReader(std::istream& input, size_t bufferSize)
+    : _input(input),
+      _buffer(std::make_unique<char[]>(bufferSize)),
+      _capacity(bufferSize) {
+  // Skip a UTF-8 byte order mark
+  if (refill() && _size >= 3 &&
+      std::memcmp(_buffer.get(), "\xEF\xBB\xBF", 3) == 0) {
+    _position = 3;
+  }
+}
+
+bool XmlReader::refill() {
+  if (!_input) {
+    return false;
+  }
+  _input.read(_buffer.get(), _capacity);
+  _size = static_cast<size_t>(_input.gcount());
+  _position = 0;
+  return _size > 0;
+}
+
+int XmlReader::peek() {
+  if (_position == _size && !refill()) {
+    return EOF;
+  }
+  return static_cast<unsigned char>(_buffer[_position]);
+}
+
+int XmlReader::get() {
+  if (_position == _size && !refill()) {
+    return EOF;
+  }
+  int c = static_cast<unsigned char>(_buffer[_position++]);
+  if (c == '\n') {
+    _line++;
+  }
+  return c;
+}
+
+bool XmlReader::fail(const std::string& message) {
+  if (_error.empty()) {
+    _error = "line " + std::to_string(_line) + ": " + message;
+  }
+  return false;
+}
+
+XmlEvent XmlReader::error(const std::string& message) {
+  fail(message);
+  return XML_ERROR;
+}
+
+bool XmlReader::expect(char expected) {
+  int c = get();
+  if (c != expected) {
+    return fail(std::string("expected '") + expected + "'" +
+                (c == EOF ? " before the end of the file" : ""));
+  }
+  return true;
+}
+
+bool XmlReader::skipPast(std::string_view terminator) {
+  std::string window;
+  for (;;) {
+    int c = get();
+    if (c == EOF) {
+      return fail("expected \"" + std::string(terminator) +
+                  "\" before the end of the file");
+    }
+    window.push_back(static_cast<char>(c));
+    if (window.size() > terminator.size()) {
+      window.erase(0, 1);
+    }
+    if (window == terminator) {
+      return true;
+    }
+  }
+}
+
+bool XmlReader::readName(std::string& out) {
+  if (!isNameStart(peek())) {
+    return fail("expected a name");
+  }
+  while (isNameChar(peek())) {
+    out.push_back(static_cast<char>(get()));
+  }
+  return true;
+}
+
+bool XmlReader::readEntity(std::string* out) {
+  // The '&' has been read; entities are short, so bound the search
+  std::string entity;
+  for (int c = get(); c != ';'; c = get()) {
+    if (c == EOF || isSpace(c) || c == '<' || entity.size() > 10) {
+      return fail("unterminated entity &" + entity);
+    }
+    entity.push_back(static_cast<char>(c));
+  }
+
+  if (entity[0] == '#') {
+    bool hex = entity.size() > 1 && entity[1] == 'x';
+    const char* first = entity.data() + (hex ? 2 : 1);
+    const char* last = entity.data() + entity.size();
+    unsigned long code = 0;
+    auto [end, status] = std::from_chars(first, last, code, hex ? 16 : 10);
+    if (first == last || status != std::errc() || end != last || code == 0 ||
+        code > 0x10FFFF) {
+      return fail("invalid character reference &" + entity + ";");
+    }
+    if (out) {
+      appendUtf8(*out, code);
+    }
+    return true;
+  }
+
+  static const std::pair<std::string_view, char> NAMED[] = {
+      {"lt", '<'}, {"gt", '>'}, {"amp", '&'}, {"quot", '"'}, {"apos", '\''}};
+  for (auto [name, value] : NAMED) {
+    if (entity == name) {
+      if (out) {
+        out->push_back(value);
+      }
+      return true;
+    }
+  }
+  return fail("unknown entity &" + entity + ";");
+}
+
+bool XmlReader::readStartTag() {
+  if (_rootClosed) {
+    return fail("more than one root element");
+  }
+
+  _tag.clear();
+  _attributes.clear();
+  if (!readName(_tag)) {
+    return false;
+  }
+  std::string element = _tag;
+
+  for (;;) {
+    bool space = false;
+    while (isSpace(peek())) {
+      get();
+      space = true;
+    }
+
+    int c = peek();
+    if (c == '>' || c == '/') {
+      get();
+      _selfClosing = c == '/';
+      if (_selfClosing && !expect('>')) {
+        return false;
+      }
+      break;
+    }
+    if (c == EOF) {
+      return fail("unexpected end of file in <" + element + ">");
+    }
+    if (!space) {
+      return fail("expected whitespace before an attribute of <" + element +
+                  ">");
+    }
+
+    _tag.push_back('\0');
+    size_t nameOffset = _tag.size();
+    if (!readName(_tag)) {
+      return false;
+    }
+    std::string_view name(_tag.data() + nameOffset, _tag.size() - nameOffset);
+    if (attribute(name)) {
+      return fail("duplicate attribute " + std::string(name) + " in <" +
+                  element + ">");
+    }
+
+    while (isSpace(peek())) {
+      get();
+    }
+    if (!expect('=')) {
+      return false;
+    }
+    while (isSpace(peek())) {
+      get();
+    }
+
+    int quote = get();
+    if (quote != '"' && quote != '\'') {
+      return fail("attribute values must be quoted in <" + element + ">");
+    }
+    _tag.push_back('\0');
+    size_t valueOffset = _tag.size();
+    for (c = get(); c != quote; c = get()) {
+      if (c == EOF) {
+        return fail("unexpected end of file in <" + element + ">");
+      }
+      if (c == '<') {
+        return fail("'<' in an attribute value of <" + element + ">");
+      }
+      if (c == '&') {
+        if (!readEntity(&_tag)) {
+          return false;
+        }
+      } else {
+        _tag.push_back(static_cast<char>(c));
+      }
+    }
+    _attributes.emplace_back(nameOffset, valueOffset);
+  }
+
+  _tag.push_back('\0');
+  _open.push_back(std::move(element));
+  _rootOpened = true;
+  return true;
+}
+
+bool XmlReader::readEndTag() {
+  _tag.clear();
+  _attributes.clear();
+  if (!readName(_tag)) {
+    return false;
+  }
+  while (isSpace(peek())) {
+    get();
+  }
+  if (!expect('>')) {
+    return false;
+  }
+
+  if (_open.empty()) {
+    return fail("</" + _tag + "> without a matching start tag");
+  }
+  if (_open.back() != _tag) {
+    return fail("</" + _tag + "> does not close <" + _open.back() + ">");
+  }
+  _open.pop_back();
+  _rootClosed = _open.empty();
+  return true;
+}
+
+bool XmlReader::readMarkup() {
+  // The "<!" has been read
+  if (peek() == '-') {
+    get();
+    return expect('-') && skipPast("-->");
+  }
+
+  if (peek() == '[') {
+    for (char c : std::string_view("[CDATA[")) {
+      if (!expect(c)) {
+        return false;
+      }
+    }
+    if (_open.empty()) {
+      return fail("CDATA section outside the root element");
+    }
+    return skipPast("]]>");
+  }
+
+  std::string keyword;
+  if (!readName(keyword) || keyword != "DOCTYPE" || _rootOpened) {
+    return fail("unexpected <!" + keyword);
+  }
+  // Skip the declaration, including an internal subset in brackets
+  int nesting = 0;
+  for (int c = get(); c != '>' || nesting > 0; c = get()) {
+    if (c == EOF) {
+      return fail("unexpected end of file in <!DOCTYPE");
+    }
+    nesting += c == '[' ? 1 : c == ']' ? -1 : 0;
+  }
+  return true;
+}
+
+XmlEvent XmlReader::next() {
+  if (failed()) {
+    return XML_ERROR;
+  }
+
+  if (_selfClosing) {
+    // The name is still at the front of _tag
+    _selfClosing = false;
+    _attributes.clear();
+    _open.pop_back();
+    _rootClosed = _open.empty();
+    return XML_END;
+  }
+
+  for (;;) {
+    int c = get();
+    if (c == EOF) {
+      if (!_open.empty()) {
+        return error("unexpected end of file inside <" + _open.back() + ">");
+      }
+      if (!_rootOpened) {
+        return error("no root element");
+      }
+      return XML_EOF;
+    }
+
+    if (c != '<') {
+      // Text is skipped, but must be well-formed
+      if (_open.empty() && !isSpace(c)) {
+        return error("text outside the root element");
+      }
+      if (c == '&' && !readEntity(nullptr)) {
+        return XML_ERROR;
+      }
+      continue;
+    }
+
+    c = peek();
+    if (c == '?') {
+      get();
+      if (!skipPast("?>")) {
+        return XML_ERROR;
+      }
+    } else if (c == '!') {
+      get();
+      if (!readMarkup()) {
+        return XML_ERROR;
+      }
+    } else if (c == '/') {
+      get();
+      return readEndTag() ? XML_END : XML_ERROR;
+    } else {
+      return readStartTag() ? XML_START : XML_ERROR;
+    }
+  }
+}
+
+bool XmlReader::nextChild(size_t parentDepth) {
+  for (;;) {
+    switch (next()) {
+      case XML_START:
+        if (depth() == parentDepth + 1) {
+          return true;
+        }
+        break;
+      case XML_END:
+        if (depth() < parentDepth) {
+          return false;
+        }
+        break;
+      default:
+        return false;
+    }
+  }
+}
+
+const char* XmlReader::attribute(std::string_view name) const {
+  for (auto [nameOffset, valueOffset] : _attributes) {
+    if (name == _tag.c_str() + nameOffset) {
+      return _tag.c_str() + valueOffset;
+    }
+  }
+  return nullptr;
+}
+
+bool XmlReader::attribute(std::string_view name, const char*& value) {
+  value = attribute(name);
+  if (!value) {
+    return fail("<" + std::string(this->name()) + "> needs a " +
+                std::string(name) + " attribute");
+  }
+  return true;
+}
+
+/**
+ * Parses a whole attribute value as a number, allowing surrounding spaces
+ * and a leading '+'
+ */
+template <typename T>
+static bool parseNumber(std::string_view text, T& value) {
+  while (!text.empty() && isSpace(text.front())) text.remove_prefix(1);
+  while (!text.empty() && isSpace(text.back())) text.remove_suffix(1);
+  if (!text.empty() && text.front() == '+') text.remove_prefix(1);
+
+  const char* last = text.data() + text.size();
+  auto [end, status] = std::from_chars(text.data(), last, value);
+  return !text.empty() && status == std::errc() && end == last;
+}
+
+template <typename T>
+static bool readNumber(XmlReader& reader, std::string_view name, T& value,
+                       bool required) {
+  const char* text = reader.attribute(name);
+  if (!text) {
+    return required ? reader.attribute(name, text) : true;
+  }
+  if (!parseNumber(text, value)) {
+    return reader.fail("attribute " + std::string(name) + " of <" +
+                       std::string(reader.name()) + "> is not a number: \"" +
+                       text + "\"");
+  }
+  return true;
+}
+
+bool XmlReader::attribute(std::string_view name, float& value) {
+  return readNumber(*this, name, value, true);
+}
+
+bool XmlReader::attribute(std::string_view name, int& value) {
+  return readNumber(*this, name, value, true);
+}
+
+bool XmlReader::optionalAttribute(std::string_view name, float& value) {
+  return readNumber(*this, name, value, false);
+}
+
+bool XmlReader::optionalAttribute(std::string_view name, unsigned& value) {
+  return readNumber(*this, name, value, false);
+}
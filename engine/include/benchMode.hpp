@@ -0,0 +1,26 @@
+#ifndef BENCHMODE_HPP
+#define BENCHMODE_HPP
+
+#include <string>
+
+/**
+ * Options for the deterministic benchmark mode:
+ * engine --bench <scene> [--frames N] [--resolution WxH] [--timestep S]
+ *        [--threads N] [--cull] [--output file.csv|file.json]
+ */
+struct BenchOptions {
+  std::string sceneFile;
+  int frames = 600;
+  int width = 1280;
+  int height = 720;
+  float timestep = 1.0f / 60.0f;  // Fixed animation step in seconds
+  unsigned threads = 0;           // Transform update threads (0 = all)
+  bool cull = false;              // Frustum cull models with the BVH
+  std::string outputFile = "bench_results.csv";
+};
+
+bool parseBenchArguments(int argc, char** argv, BenchOptions& options);
+
+int runBenchmark(const BenchOptions& options);
+
+#endif  // BENCHMODE_HPP
@@ -0,0 +1,43 @@
+#ifndef HEADLESS_HPP
+#define HEADLESS_HPP
+
+#include <GL/glew.h>
+
+/**
+ * Offscreen OpenGL context used by the benchmark mode.
+ *
+ * When the engine is built with EGL support the context is created on a
+ * surfaceless EGL display (Mesa's llvmpipe works without a GPU or X server).
+ * Otherwise a hidden GLUT window provides the context. In both cases all
+ * rendering goes to a framebuffer object of the requested size, so results do
+ * not depend on the window size or on vsync.
+ */
+class HeadlessContext {
+ public:
+  HeadlessContext() = default;
+  HeadlessContext(const HeadlessContext&) = delete;
+  HeadlessContext& operator=(const HeadlessContext&) = delete;
+  ~HeadlessContext();
+
+  bool create(int width, int height);
+  void destroy();
+
+  // Binds the offscreen framebuffer as the render target
+  void bind();
+
+  bool isEGL() const { return _egl; }
+
+ private:
+  bool createEGL();
+  bool createGLUT(int width, int height);
+  bool createFramebuffer(int width, int height);
+
+  bool _egl = false;
+  bool _created = false;
+  void* _display = nullptr;
+  void* _context = nullptr;
+  int _window = 0;
+  GLuint _fbo = 0, _color = 0, _depth = 0;
+};
+
+#endif  // HEADLESS_HPP
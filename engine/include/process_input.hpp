@@ -3,6 +3,7 @@
 #include <bitset>
 #include <cstdint>
 #include <glm/glm.hpp>
+#include <mutex>
 
 struct Keyboard {
   enum Key : uint16_t {
@@ -34,6 +35,14 @@ struct Mouse {
   };
 };
 
+/**
+ * Keyboard and mouse state.
+ *
+ * The GLUT callbacks record events on the window thread, into a live state
+ * guarded by a mutex. The simulation thread copies it once per step in
+ * process_input(), and every query below reads that copy, so the state
+ * doesn't change in the middle of a step.
+ */
 class Input {
  public:
   // Keyboard event callbacks
@@ -44,7 +53,7 @@ class Input {
   // Mouse event callbacks
   static void on_mouse_motion(int x, int y);
   static void on_mouse_button(int button, int state, int, int);
-  // Updates input state (only mouse delta for now)
+  // Takes the state recorded since the last call, and the mouse delta
   static void process_input();
 
   // Keyboard
@@ -61,12 +70,28 @@ class Input {
 
   static glm::vec2 mouse_delta() { return s_mouse_delta; }
 
-  static glm::vec2 mouse_position() { return s_mouse_position; }
+  static glm::vec2 mouse_position() { return s_state.mouse_position; }
+
+  // Takes the position of the last left click, if one happened before the
+  // last process_input() and wasn't taken since
+  static bool consume_click(glm::ivec2& position);
 
  private:
-  inline static std::bitset<Keyboard::Key::_Count> s_keyboard_state;
-  inline static std::bitset<Mouse::Button::_Count> s_mouse_state;
-  inline static glm::ivec2 s_mouse_position = glm::ivec2{};
+  // Zero-initialized as statics
+  struct State {
+    std::bitset<Keyboard::Key::_Count> keyboard;
+    std::bitset<Mouse::Button::_Count> mouse;
+    glm::ivec2 mouse_position;
+    bool click_pending;
+    glm::ivec2 click_position;
+  };
+
+  // Written by the callbacks
+  inline static std::mutex s_mutex;
+  inline static State s_live;
+
+  // Copy read by the queries
+  inline static State s_state;
   inline static glm::ivec2 s_mouse_delta = glm::ivec2{};
 
  private:
@@ -1,9 +0,0 @@
-#ifndef READFILE_HPP
-#define READFILE_HPP
-
-#include "Model.hpp"
-#include "utils.hpp"
-
-Model readFile(const char* filepath);
-
-#endif  // READ_HPP
\ No newline at end of file
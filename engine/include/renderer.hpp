@@ -0,0 +1,62 @@
+#ifndef RENDERER_HPP
+#define RENDERER_HPP
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "Model.hpp"
+#include "catmullCurves.hpp"
+#include "framePacket.hpp"
+#include "frameStats.hpp"
+#include "instanceSet.hpp"
+#include "light.hpp"
+#include "sceneGraph.hpp"
+
+/**
+ * OpenGL backend of the engine.
+ *
+ * The scene, its meshes and its transforms live in engine_core, which never
+ * calls GL. These functions upload them and draw them with the
+ * fixed-function pipeline, and must be called on the thread that owns the
+ * GL context.
+ */
+
+// Uploads the model's mesh, unless another model sharing it did, and its
+// texture. Does nothing the second time
+void initModel(Model& model);
+
+// Binds the texture and the mesh buffers of the model for drawing
+void bindModel(Model& model);
+
+// Draws the model under the current modelview matrix
+void drawModel(Model& model);
+
+// Draws the vertex normals of the model, for debugging
+void drawNormals(const Model& model);
+
+// Enables one GL light per scene light. False if the scene has none
+bool setupLights(const std::vector<Light>& lights);
+
+// Places the lights under the current modelview matrix
+void drawLights(const std::vector<Light>& lights);
+
+void setupMaterial(const Material& m);
+
+// Draws every instance of the set, at the given matrices relative to the
+// current modelview matrix. They are uploaded again when they come from a
+// different frame packet, since culling changes them even while the
+// animation is paused
+void drawInstanceSet(InstanceSet& set, const std::vector<glm::mat4>& matrices,
+                     uint64_t frame, bool lights, FrameStats& stats);
+
+// Draws the models and instances of a simulated frame (every one, or those
+// left by culling) with the frame's matrices. Only reads
+// the structure of the graph, so the simulation may update it meanwhile
+void drawFrame(const SceneGraph& graph, const FramePacket& frame, bool lights,
+               bool normals, FrameStats& stats);
+
+// Draws the path of a curve translation as a line loop
+void drawCatmullRomCurve(TimeTranslations& translation);
+
+#endif  // RENDERER_HPP
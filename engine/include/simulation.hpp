@@ -0,0 +1,96 @@
+#ifndef SIMULATION_HPP
+#define SIMULATION_HPP
+
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "Camera.hpp"
+#include "bvh.hpp"
+#include "cameraController.hpp"
+#include "frameClock.hpp"
+#include "framePacket.hpp"
+#include "sceneGraph.hpp"
+#include "tripleBuffer.hpp"
+
+/**
+ * Settings the UI changes while the scene runs, applied at the start of
+ * every simulation step
+ */
+struct SimulationSettings {
+  float speed = 1.0f;         // Animation speed
+  bool paused = false;        // Animation paused
+  bool fixed_step = false;    // Advance the animation by STEP per step
+  bool culling = false;       // Cull the models against the view frustum
+  bool ui_has_mouse = false;  // Clicks belong to the UI, not to picking
+  int width = 1, height = 1;  // Window size
+};
+
+/**
+ * Input, camera, animation and transforms, on their own thread.
+ *
+ * Every step processes the input, moves the camera, advances the clock,
+ * updates the scene graph and its BVH, culls and picks, and publishes the
+ * result as a FramePacket. Steps run at a fixed rate whatever the renderer
+ * does, so a slow frame doesn't delay the input. The renderer takes the
+ * newest packet when it starts a frame, while the next ones are simulated.
+ */
+class Simulation {
+ public:
+  // Steps per second, and the animation step of fixed_step
+  static constexpr int RATE = 120;
+  static constexpr double STEP = 1.0 / RATE;
+
+  Simulation() = default;
+  Simulation(const Simulation&) = delete;
+  Simulation& operator=(const Simulation&) = delete;
+  ~Simulation() { stop(); }
+
+  // Starts stepping the graph, which must keep its structure until stop(),
+  // from the given camera
+  void start(SceneGraph& graph, const Camera& camera);
+  void stop();
+
+  // Newest packet, nullptr until the first one. Stays valid until the next
+  // call; only the renderer calls it
+  const FramePacket* acquire();
+
+  void setSettings(const SimulationSettings& settings);
+
+  // Requests for the next step
+  void scrubTo(double time);
+  void resetCamera();
+  void clearSelection();
+
+  // Shown with F1, hidden with F2
+  bool showUI() const { return _showUI; }
+
+ private:
+  void run();
+  void step();
+
+  SceneGraph* _graph = nullptr;
+  BVH _bvh;
+  Camera _initialCamera, _camera;
+  std::optional<CameraController> _controller;
+  FrameClock _clock;
+  PickResult _selection;
+  double _pickMs = 0.0;
+  uint64_t _frame = 0;
+
+  TripleBuffer<FramePacket> _packets;
+  bool _hasPacket = false;
+
+  std::mutex _mutex;  // Guards the settings and the requests
+  SimulationSettings _settings;
+  std::optional<double> _scrubTo;
+  bool _resetCamera = false;
+  bool _clearSelection = false;
+
+  std::atomic<bool> _showUI{false};
+  std::atomic<bool> _stop{false};
+  std::thread _thread;
+};
+
+#endif  // SIMULATION_HPP
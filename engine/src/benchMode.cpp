@@ -0,0 +1,366 @@
+#include "benchMode.hpp"
+
+#include "headless.hpp"
+
+extern "C" {
+#include <GL/gl.h>
+#include <GL/glu.h>
+}
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+#include "Configuration.hpp"
+#include "bvh.hpp"
+#include "filesParser.hpp"
+#include "frameClock.hpp"
+#include "framePacket.hpp"
+#include "frameStats.hpp"
+#include "jobSystem.hpp"
+#include "readFile.hpp"
+#include "renderer.hpp"
+#include "sceneGraph.hpp"
+
+/**
+ * Measurements taken for a single benchmark frame
+ */
+struct BenchSample {
+  float time;    // Animation time in seconds
+  double cpuMs;  // CPU time spent updating and submitting the frame
+  double gpuMs;  // GPU time from a timer query (negative if unavailable)
+  double bvhMs;  // Part of the CPU time spent refitting the BVH
+  FrameStats stats;
+};
+
+/**
+ * Summary statistics over one column of the samples
+ */
+struct BenchSummary {
+  double mean, min, p50, p90, p95, p99, max;
+};
+
+/**
+ * Parses the value of a command line option as a positive number. Prints an
+ * error naming the option if it is not one
+ */
+template <typename T>
+static bool parsePositive(const char* option, const char* text, T& value) {
+  std::string_view view(text);
+  const char* last = view.data() + view.size();
+  auto [end, status] = std::from_chars(view.data(), last, value);
+  if (view.empty() || status != std::errc() || end != last || !(value > 0)) {
+    std::cerr << "Invalid value for " << option << ": " << text
+              << " (expected a positive number)" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool parseBenchArguments(int argc, char** argv, BenchOptions& options) {
+  if (argc < 3) {
+    return false;
+  }
+  options.sceneFile = argv[2];
+
+  for (int i = 3; i < argc; i++) {
+    bool hasValue = i + 1 < argc;
+    if (strcmp(argv[i], "--frames") == 0 && hasValue) {
+      if (!parsePositive(argv[i], argv[i + 1], options.frames)) {
+        return false;
+      }
+      i++;
+    } else if (strcmp(argv[i], "--resolution") == 0 && hasValue) {
+      if (sscanf(argv[++i], "%dx%d", &options.width, &options.height) != 2 ||
+          options.width <= 0 || options.height <= 0) {
+        std::cerr << "Invalid resolution: " << argv[i] << std::endl;
+        return false;
+      }
+    } else if (strcmp(argv[i], "--timestep") == 0 && hasValue) {
+      if (!parsePositive(argv[i], argv[i + 1], options.timestep)) {
+        return false;
+      }
+      i++;
+    } else if (strcmp(argv[i], "--threads") == 0 && hasValue) {
+      // Parsed signed, so a negative count isn't wrapped around
+      int threads = 0;
+      if (!parsePositive(argv[i], argv[i + 1], threads)) {
+        return false;
+      }
+      options.threads = static_cast<unsigned>(threads);
+      i++;
+    } else if (strcmp(argv[i], "--cull") == 0) {
+      options.cull = true;
+    } else if (strcmp(argv[i], "--output") == 0 && hasValue) {
+      options.outputFile = argv[++i];
+    } else {
+      std::cerr << "Unknown benchmark option: " << argv[i] << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Recursively uploads every model of the group to the GPU
+ */
+static void initGroupModels(ModelGroup& group) {
+  for (Model& model : group.models) {
+    initModel(model);
+  }
+  for (InstanceSet& set : group.instances) {
+    initModel(set.model);
+  }
+  for (ModelGroup& subgroup : group.subModelgroups) {
+    initGroupModels(subgroup);
+  }
+}
+
+/**
+ * Scripted camera path: one full orbit around the scene's lookAt point,
+ * keeping the configured distance and height
+ *
+ * @param camera Camera from the scene file
+ * @param progress Position along the path in [0, 1)
+ */
+static glm::vec3 scriptedCameraPosition(const Camera& camera, float progress) {
+  glm::vec3 offset = camera.position - camera.lookAt;
+  glm::mat4 orbit = glm::rotate(glm::mat4(1.0f),
+                                2.0f * static_cast<float>(M_PI) * progress,
+                                glm::normalize(camera.up));
+  return camera.lookAt + glm::vec3(orbit * glm::vec4(offset, 0.0f));
+}
+
+static BenchSummary summarize(std::vector<double> values) {
+  std::sort(values.begin(), values.end());
+  auto percentile = [&](double p) {
+    size_t rank = static_cast<size_t>(std::ceil(p * values.size()));
+    return values[std::clamp<size_t>(rank, 1, values.size()) - 1];
+  };
+
+  double total = 0.0;
+  for (double value : values) {
+    total += value;
+  }
+
+  return {total / values.size(), values.front(), percentile(0.50),
+          percentile(0.90),      percentile(0.95), percentile(0.99),
+          values.back()};
+}
+
+static void printSummary(const char* label, const BenchSummary& s) {
+  printf("%-4s ms  mean %8.3f  min %8.3f  p50 %8.3f  p90 %8.3f  p95 %8.3f  "
+         "p99 %8.3f  max %8.3f\n",
+         label, s.mean, s.min, s.p50, s.p90, s.p95, s.p99, s.max);
+}
+
+static void writeSummaryJSON(std::ofstream& out, const char* name,
+                             const BenchSummary& s) {
+  out << "    \"" << name << "\": {\"mean\": " << s.mean
+      << ", \"min\": " << s.min << ", \"p50\": " << s.p50
+      << ", \"p90\": " << s.p90 << ", \"p95\": " << s.p95
+      << ", \"p99\": " << s.p99 << ", \"max\": " << s.max << "}";
+}
+
+static bool writeResults(const BenchOptions& options,
+                         const std::vector<BenchSample>& samples,
+                         const BenchSummary& cpu, const BenchSummary* gpu) {
+  std::ofstream out(options.outputFile);
+  if (!out.is_open()) {
+    std::cerr << "Error: Unable to open " << options.outputFile << std::endl;
+    return false;
+  }
+
+  if (std::filesystem::path(options.outputFile).extension() == ".json") {
+    out << "{\n  \"scene\": \"" << options.sceneFile << "\",\n"
+        << "  \"resolution\": [" << options.width << ", " << options.height
+        << "],\n  \"timestep\": " << options.timestep << ",\n"
+        << "  \"summary\": {\n";
+    writeSummaryJSON(out, "cpu_ms", cpu);
+    if (gpu) {
+      out << ",\n";
+      writeSummaryJSON(out, "gpu_ms", *gpu);
+    }
+    out << "\n  },\n  \"frames\": [\n";
+    for (size_t i = 0; i < samples.size(); i++) {
+      const BenchSample& s = samples[i];
+      out << "    {\"frame\": " << i << ", \"time\": " << s.time
+          << ", \"cpu_ms\": " << s.cpuMs << ", \"gpu_ms\": " << s.gpuMs
+          << ", \"bvh_ms\": " << s.bvhMs
+          << ", \"draw_calls\": " << s.stats.draw_calls
+          << ", \"triangles\": " << s.stats.triangles
+          << ", \"matrices\": " << s.stats.matrices_recomputed << "}"
+          << (i + 1 < samples.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+  } else {
+    out << "frame,time_s,cpu_ms,gpu_ms,bvh_ms,draw_calls,triangles,"
+           "matrices\n";
+    for (size_t i = 0; i < samples.size(); i++) {
+      const BenchSample& s = samples[i];
+      out << i << "," << s.time << "," << s.cpuMs << "," << s.gpuMs << ","
+          << s.bvhMs << "," << s.stats.draw_calls << ","
+          << s.stats.triangles << "," << s.stats.matrices_recomputed << "\n";
+    }
+  }
+
+  std::cout << "Results written to " << options.outputFile << std::endl;
+  return true;
+}
+
+/**
+ * Renders the scene offscreen for a fixed number of frames, driving animation
+ * with a fixed timestep and the camera along a scripted path
+ */
+int runBenchmark(const BenchOptions& options) {
+  HeadlessContext context;
+  if (!context.create(options.width, options.height)) {
+    std::cerr << "Error: Unable to create an offscreen context" << std::endl;
+    return 1;
+  }
+
+  JobSystem jobs(options.threads);
+  Configuration scene = parseSceneFile(options.sceneFile, &jobs);
+
+  // Same fixed-function state as the interactive viewer
+  context.bind();
+  glEnableClientState(GL_VERTEX_ARRAY);
+  glEnableClientState(GL_NORMAL_ARRAY);
+  glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+  glEnable(GL_DEPTH_TEST);
+  glEnable(GL_CULL_FACE);
+  glEnable(GL_TEXTURE_2D);
+  bool lighting = setupLights(scene.lights);
+  initGroupModels(scene.modelGroup);
+  releaseTextures();
+
+  SceneGraph graph;
+  graph.build(scene.modelGroup);
+  graph.setJobSystem(&jobs);
+  BVH bvh;
+  FramePacket packet;
+  packet.culled = options.cull;
+
+  glMatrixMode(GL_PROJECTION);
+  glLoadIdentity();
+  gluPerspective(scene.camera.fov,
+                 static_cast<float>(options.width) / options.height,
+                 scene.camera.nearPlane, scene.camera.farPlane);
+  glMatrixMode(GL_MODELVIEW);
+
+  bool gpuTimers = GLEW_VERSION_3_3 || GLEW_ARB_timer_query;
+  std::vector<GLuint> queries(options.frames);
+  if (gpuTimers) {
+    glGenQueries(options.frames, queries.data());
+  } else {
+    std::cerr << "Timer queries unsupported, GPU times not recorded"
+              << std::endl;
+  }
+
+  std::vector<BenchSample> samples;
+  samples.reserve(options.frames);
+
+  FrameClock clock;
+  clock.setFixedStep(options.timestep);
+
+  for (int frame = 0; frame < options.frames; frame++) {
+    float animationTime = static_cast<float>(clock.time());
+    glm::vec3 eye = scriptedCameraPosition(
+        scene.camera, static_cast<float>(frame) / options.frames);
+
+    auto start = std::chrono::steady_clock::now();
+    if (gpuTimers) {
+      glBeginQuery(GL_TIME_ELAPSED, queries[frame]);
+    }
+
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glLoadIdentity();
+    gluLookAt(eye.x, eye.y, eye.z, scene.camera.lookAt.x,
+              scene.camera.lookAt.y, scene.camera.lookAt.z, scene.camera.up.x,
+              scene.camera.up.y, scene.camera.up.z);
+    if (lighting) {
+      drawLights(scene.lights);
+    }
+
+    FrameStats stats;
+    graph.update(clock.time(), stats);
+    if (!bvh.built()) {
+      bvh.build(graph);
+    } else {
+      bvh.refit(graph);
+    }
+
+    // Drawn from a frame packet, like the interactive viewer
+    captureFrame(graph, clock.time(), packet);
+    packet.frame = frame + 1;
+    if (options.cull) {
+      glGetFloatv(GL_PROJECTION_MATRIX, &packet.projection[0][0]);
+      glGetFloatv(GL_MODELVIEW_MATRIX, &packet.view[0][0]);
+      cullFrame(bvh, Frustum(packet.projection * packet.view), packet);
+    }
+    drawFrame(graph, packet, lighting, false, stats);
+
+    if (gpuTimers) {
+      glEndQuery(GL_TIME_ELAPSED);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    samples.push_back(
+        {animationTime,
+         std::chrono::duration<double, std::milli>(end - start).count(), -1.0,
+         frame == 0 ? bvh.buildMs() : bvh.refitMs(), stats});
+    clock.tick();
+  }
+  glFinish();
+
+  // Timer results are only read back once all frames have been submitted, so
+  // the readback does not stall the measured frames
+  std::vector<double> cpuTimes, gpuTimes, bvhTimes;
+  for (int frame = 0; frame < options.frames; frame++) {
+    if (gpuTimers) {
+      GLuint64 elapsedNs = 0;
+      glGetQueryObjectui64v(queries[frame], GL_QUERY_RESULT, &elapsedNs);
+      samples[frame].gpuMs = elapsedNs / 1.0e6;
+      gpuTimes.push_back(samples[frame].gpuMs);
+    }
+    cpuTimes.push_back(samples[frame].cpuMs);
+    if (frame > 0) {
+      bvhTimes.push_back(samples[frame].bvhMs);
+    }
+  }
+  if (gpuTimers) {
+    glDeleteQueries(options.frames, queries.data());
+  }
+
+  printf("Benchmark: %s, %d frames at %dx%d, %u threads, %d draws / %ld "
+         "triangles\n",
+         options.sceneFile.c_str(), options.frames, options.width,
+         options.height, jobs.threadCount(), samples.back().stats.draw_calls,
+         samples.back().stats.triangles);
+  printf("BVH: %zu nodes (%zu static / %zu animated models), built in "
+         "%.3f ms\n",
+         bvh.nodeCount(), bvh.staticCount(), bvh.dynamicCount(),
+         samples.front().bvhMs);
+  BenchSummary cpu = summarize(cpuTimes);
+  printSummary("CPU", cpu);
+  if (!bvhTimes.empty()) {
+    printSummary("BVH", summarize(bvhTimes));
+  }
+  BenchSummary gpu{};
+  if (gpuTimers) {
+    gpu = summarize(gpuTimes);
+    printSummary("GPU", gpu);
+  }
+
+  return writeResults(options, samples, cpu, gpuTimers ? &gpu : nullptr) ? 0
+                                                                          : 1;
+}
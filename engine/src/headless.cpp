@@ -0,0 +1,185 @@
+#include "headless.hpp"
+
+extern "C" {
+#include <GL/gl.h>
+#ifdef __APPLE_CC__
+#include <GLUT/glut.h>
+#else
+#include <GL/freeglut.h>
+#endif
+}
+
+#ifdef ENGINE_HEADLESS_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+#include <iostream>
+
+HeadlessContext::~HeadlessContext() { destroy(); }
+
+/**
+ * Creates the offscreen context and a framebuffer of the given size
+ */
+bool HeadlessContext::create(int width, int height) {
+  if (this->_created) {
+    return true;
+  }
+
+  this->_egl = createEGL();
+  if (!this->_egl) {
+    std::cerr << "EGL unavailable, falling back to a hidden GLUT window"
+              << std::endl;
+    if (!createGLUT(width, height)) {
+      return false;
+    }
+  }
+
+  glewExperimental = GL_TRUE;
+  GLenum status = glewInit();
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+  // GLEW built for GLX complains about the missing X display but still loads
+  // the entry points through the current EGL context
+  if (this->_egl && status == GLEW_ERROR_NO_GLX_DISPLAY) {
+    status = GLEW_OK;
+  }
+#endif
+  if (status != GLEW_OK) {
+    std::cerr << "Error: Failed to initialize GLEW: "
+              << glewGetErrorString(status) << std::endl;
+    return false;
+  }
+
+  std::cout << "Renderer: " << glGetString(GL_RENDERER) << " ("
+            << glGetString(GL_VERSION) << ")" << std::endl;
+
+  this->_created = createFramebuffer(width, height);
+  return this->_created;
+}
+
+/**
+ * Creates a desktop OpenGL context on a surfaceless EGL display
+ */
+bool HeadlessContext::createEGL() {
+#ifdef ENGINE_HEADLESS_EGL
+  EGLDisplay display = EGL_NO_DISPLAY;
+
+#ifdef EGL_PLATFORM_SURFACELESS_MESA
+  auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+      eglGetProcAddress("eglGetPlatformDisplayEXT"));
+  if (getPlatformDisplay) {
+    display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA,
+                                 EGL_DEFAULT_DISPLAY, nullptr);
+  }
+#endif
+  if (display == EGL_NO_DISPLAY) {
+    display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+  }
+  if (display == EGL_NO_DISPLAY || !eglInitialize(display, nullptr, nullptr)) {
+    return false;
+  }
+
+  // No surface bits: everything is drawn into our own framebuffer object
+  const EGLint configAttribs[] = {EGL_SURFACE_TYPE,    0,
+                                  EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+                                  EGL_DEPTH_SIZE,      24,
+                                  EGL_NONE};
+  EGLConfig config;
+  EGLint configCount = 0;
+  if (!eglChooseConfig(display, configAttribs, &config, 1, &configCount) ||
+      configCount == 0 || !eglBindAPI(EGL_OPENGL_API)) {
+    eglTerminate(display);
+    return false;
+  }
+
+  EGLContext context =
+      eglCreateContext(display, config, EGL_NO_CONTEXT, nullptr);
+  if (context == EGL_NO_CONTEXT ||
+      !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+    eglTerminate(display);
+    return false;
+  }
+
+  this->_display = display;
+  this->_context = context;
+  return true;
+#else
+  return false;
+#endif
+}
+
+/**
+ * Creates a hidden GLUT window to own the context when EGL is not available
+ */
+bool HeadlessContext::createGLUT(int width, int height) {
+  int argc = 1;
+  char name[] = "engine";
+  char* argv[] = {name, nullptr};
+  glutInit(&argc, argv);
+  glutInitDisplayMode(GLUT_DEPTH | GLUT_RGBA);
+  glutInitWindowSize(width, height);
+  this->_window = glutCreateWindow("3D Scene Renderer (benchmark)");
+  if (this->_window <= 0) {
+    std::cerr << "Error: Failed to create a GLUT window" << std::endl;
+    return false;
+  }
+  glutHideWindow();
+  return true;
+}
+
+/**
+ * Creates the color and depth renderbuffers used as the render target
+ */
+bool HeadlessContext::createFramebuffer(int width, int height) {
+  glGenRenderbuffers(1, &this->_color);
+  glBindRenderbuffer(GL_RENDERBUFFER, this->_color);
+  glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+
+  glGenRenderbuffers(1, &this->_depth);
+  glBindRenderbuffer(GL_RENDERBUFFER, this->_depth);
+  glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+
+  glGenFramebuffers(1, &this->_fbo);
+  glBindFramebuffer(GL_FRAMEBUFFER, this->_fbo);
+  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                            GL_RENDERBUFFER, this->_color);
+  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
+                            GL_RENDERBUFFER, this->_depth);
+
+  if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+    std::cerr << "Error: Offscreen framebuffer is incomplete" << std::endl;
+    return false;
+  }
+
+  glViewport(0, 0, width, height);
+  return true;
+}
+
+void HeadlessContext::bind() {
+  glBindFramebuffer(GL_FRAMEBUFFER, this->_fbo);
+}
+
+void HeadlessContext::destroy() {
+  if (this->_created) {
+    glDeleteFramebuffers(1, &this->_fbo);
+    glDeleteRenderbuffers(1, &this->_color);
+    glDeleteRenderbuffers(1, &this->_depth);
+    this->_created = false;
+  }
+
+#ifdef ENGINE_HEADLESS_EGL
+  if (this->_display) {
+    eglMakeCurrent(this->_display, EGL_NO_SURFACE, EGL_NO_SURFACE,
+                   EGL_NO_CONTEXT);
+    eglDestroyContext(this->_display, this->_context);
+    eglTerminate(this->_display);
+    this->_display = nullptr;
+    this->_context = nullptr;
+  }
+#endif
+
+  if (this->_window > 0) {
+    glutDestroyWindow(this->_window);
+    this->_window = 0;
+  }
+}
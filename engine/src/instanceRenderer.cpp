@@ -0,0 +1,219 @@
+#include <GL/glew.h>
+
+#include <iostream>
+
+#include "renderer.hpp"
+
+// First of the four attribute locations taking the instance matrix columns.
+// Chosen above the ones some drivers alias to gl_Vertex, gl_Normal, etc.
+static const GLuint INSTANCE_MATRIX_LOCATION = 12;
+
+/**
+ * The fixed-function transform and per-vertex lighting (OpenGL lights,
+ * material, global ambient and modulated texture), with the instance matrix
+ * applied between the model and the modelview matrix
+ */
+static const char* VERTEX_SHADER = R"(#version 120
+attribute mat4 instanceMatrix;
+uniform bool lighting;
+uniform int lightCount;
+varying vec4 color;
+
+void main() {
+  vec4 position = gl_ModelViewMatrix * (instanceMatrix * gl_Vertex);
+  gl_Position = gl_ProjectionMatrix * position;
+  gl_TexCoord[0] = gl_MultiTexCoord0;
+
+  if (!lighting) {
+    color = gl_Color;
+    return;
+  }
+
+  vec3 normal =
+      normalize(gl_NormalMatrix * (mat3(instanceMatrix) * gl_Normal));
+  vec4 result = gl_FrontLightModelProduct.sceneColor;
+  for (int i = 0; i < lightCount; i++) {
+    vec4 light = gl_LightSource[i].position;
+    vec3 toLight = normalize(light.w == 0.0 ? light.xyz
+                                            : light.xyz - position.xyz);
+    result += gl_FrontLightProduct[i].ambient;
+
+    if (gl_LightSource[i].spotCutoff <= 90.0 &&
+        dot(-toLight, normalize(gl_LightSource[i].spotDirection)) <
+            gl_LightSource[i].spotCosCutoff) {
+      continue;
+    }
+
+    float diffuse = dot(normal, toLight);
+    if (diffuse > 0.0) {
+      result += gl_FrontLightProduct[i].diffuse * diffuse;
+      float highlight = max(dot(normal, normalize(toLight + vec3(0, 0, 1))),
+                            0.0);
+      result += gl_FrontLightProduct[i].specular *
+                (gl_FrontMaterial.shininess > 0.0
+                     ? pow(highlight, gl_FrontMaterial.shininess)
+                     : 1.0);
+    }
+  }
+  color = vec4(clamp(result.rgb, 0.0, 1.0), gl_FrontMaterial.diffuse.a);
+}
+)";
+
+static const char* FRAGMENT_SHADER = R"(#version 120
+uniform bool textured;
+uniform sampler2D diffuseMap;
+varying vec4 color;
+
+void main() {
+  gl_FragColor =
+      textured ? color * texture2D(diffuseMap, gl_TexCoord[0].st) : color;
+}
+)";
+
+/**
+ * Shader program shared by every instance set
+ */
+struct InstancingProgram {
+  GLuint id = 0;  // 0 if instancing is unavailable
+  GLint lighting, lightCount, textured, diffuseMap;
+};
+
+static GLuint compileShader(GLenum type, const char* source) {
+  GLuint shader = glCreateShader(type);
+  glShaderSource(shader, 1, &source, nullptr);
+  glCompileShader(shader);
+
+  GLint compiled = GL_FALSE;
+  glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+  if (!compiled) {
+    char log[1024];
+    glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+    std::cerr << "Error compiling instancing shader: " << log << std::endl;
+    glDeleteShader(shader);
+    return 0;
+  }
+  return shader;
+}
+
+/**
+ * Builds the instancing program on first use. Without OpenGL 3.3 (instanced
+ * draws and attribute divisors) or if it fails to build, the program id is
+ * 0 and sets are drawn one instance at a time.
+ */
+static const InstancingProgram& instancingProgram() {
+  static InstancingProgram program;
+  static bool initialized = false;
+  if (initialized) {
+    return program;
+  }
+  initialized = true;
+
+  if (!GLEW_VERSION_3_3) {
+    std::cerr << "Instanced drawing unsupported, drawing instances one by one"
+              << std::endl;
+    return program;
+  }
+
+  GLuint vertex = compileShader(GL_VERTEX_SHADER, VERTEX_SHADER);
+  GLuint fragment = compileShader(GL_FRAGMENT_SHADER, FRAGMENT_SHADER);
+  if (!vertex || !fragment) {
+    return program;
+  }
+
+  GLuint id = glCreateProgram();
+  glAttachShader(id, vertex);
+  glAttachShader(id, fragment);
+  glBindAttribLocation(id, INSTANCE_MATRIX_LOCATION, "instanceMatrix");
+  glLinkProgram(id);
+  glDeleteShader(vertex);
+  glDeleteShader(fragment);
+
+  GLint linked = GL_FALSE;
+  glGetProgramiv(id, GL_LINK_STATUS, &linked);
+  if (!linked) {
+    char log[1024];
+    glGetProgramInfoLog(id, sizeof(log), nullptr, log);
+    std::cerr << "Error linking instancing shader: " << log << std::endl;
+    glDeleteProgram(id);
+    return program;
+  }
+
+  program.id = id;
+  program.lighting = glGetUniformLocation(id, "lighting");
+  program.lightCount = glGetUniformLocation(id, "lightCount");
+  program.textured = glGetUniformLocation(id, "textured");
+  program.diffuseMap = glGetUniformLocation(id, "diffuseMap");
+  return program;
+}
+
+void drawInstanceSet(InstanceSet& set, const std::vector<glm::mat4>& matrices,
+                     uint64_t frame, bool lights, FrameStats& stats) {
+  if (matrices.empty()) {
+    return;
+  }
+
+  if (lights) {
+    setupMaterial(set.model.material);
+  }
+  long triangles = static_cast<long>(set.model.mesh->ibo.size() / 3);
+
+  const InstancingProgram& program = instancingProgram();
+  if (!program.id) {
+    for (const glm::mat4& matrix : matrices) {
+      glPushMatrix();
+      glMultMatrixf(&matrix[0][0]);
+      drawModel(set.model);
+      glPopMatrix();
+    }
+    stats.draw_calls += static_cast<int>(matrices.size());
+    stats.triangles += triangles * static_cast<long>(matrices.size());
+    return;
+  }
+
+  // The matrices only change from one frame packet to the next
+  if (!set.instance_buffer) {
+    glGenBuffers(1, &set.instance_buffer);
+  }
+  glBindBuffer(GL_ARRAY_BUFFER, set.instance_buffer);
+  if (set.uploaded_frame != frame) {
+    glBufferData(GL_ARRAY_BUFFER, sizeof(glm::mat4) * matrices.size(),
+                 matrices.data(), GL_STREAM_DRAW);
+    set.uploaded_frame = frame;
+  }
+
+  // One column per attribute location, advancing once per instance
+  for (GLuint column = 0; column < 4; column++) {
+    GLuint location = INSTANCE_MATRIX_LOCATION + column;
+    glEnableVertexAttribArray(location);
+    glVertexAttribPointer(
+        location, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4),
+        reinterpret_cast<const void*>(sizeof(glm::vec4) * column));
+    glVertexAttribDivisor(location, 1);
+  }
+
+  bindModel(set.model);
+
+  GLint lightCount = 0;
+  while (lightCount < 8 && glIsEnabled(GL_LIGHT0 + lightCount)) {
+    lightCount++;
+  }
+  glUseProgram(program.id);
+  glUniform1i(program.lighting, lights && glIsEnabled(GL_LIGHTING));
+  glUniform1i(program.lightCount, lightCount);
+  glUniform1i(program.textured,
+              set.model.hasTexture() && glIsEnabled(GL_TEXTURE_2D));
+  glUniform1i(program.diffuseMap, 0);
+
+  glDrawElementsInstanced(GL_TRIANGLES, set.model.mesh->ibo.size(),
+                          GL_UNSIGNED_INT, 0, matrices.size());
+
+  glUseProgram(0);
+  for (GLuint column = 0; column < 4; column++) {
+    glVertexAttribDivisor(INSTANCE_MATRIX_LOCATION + column, 0);
+    glDisableVertexAttribArray(INSTANCE_MATRIX_LOCATION + column);
+  }
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  stats.draw_calls++;
+  stats.triangles += triangles * static_cast<long>(matrices.size());
+}
@@ -11,15 +11,22 @@ extern "C" {
 #define _USE_MATH_DEFINES
 #include <math.h>
 
-#include <chrono>
+#include <algorithm>
+#include <string>
 #include <unordered_map>
 
 #include "Configuration.hpp"
-#include "cameraController.hpp"
+#include "benchMode.hpp"
 #include "catmullCurves.hpp"
 #include "filesParser.hpp"
+#include "framePacket.hpp"
+#include "jobSystem.hpp"
 #include "menuGUI.hpp"
 #include "process_input.hpp"
+#include "readFile.hpp"
+#include "renderer.hpp"
+#include "sceneGraph.hpp"
+#include "simulation.hpp"
 
 // Global scene configuration variables
 std::string sceneFile;
@@ -31,21 +38,28 @@ bool wireframeMode = false;
 bool showNormals = false;
 bool backfaceCulling = false;
 bool enableLighting = false;
+bool frustumCulling = false;
 float animationSpeed = 1.0f;
+bool animationPaused = false;
+bool fixedTimestep = false;
 bool showModelDetails = false;
-bool showUI = false;
+bool showSceneStats = false;
+int windowWidth = 1, windowHeight = 1;
+// Set by the UI, the scene is reloaded at the start of the next frame
+bool reloadRequested = false;
 
 // Statistics tracking
 int modelCountTotal = 0;
 int modelCountVisible = 0;
 
-// Performance tracking
-int timeStart;
-float frameCount;
-
 // Scene data
 Configuration sceneConfig;
-Camera mainCamera;
+SceneGraph sceneGraph;
+JobSystem jobSystem;
+
+// Steps the camera and the scene graph on its own thread. Declared after the
+// scene, so it stops before the scene is destroyed
+Simulation simulation;
 
 /**
  * Structure to hold mesh statistics for display in UI
@@ -65,22 +79,13 @@ std::unordered_map<std::string, MeshStats> modelStatistics;
  * @param height New window height
  */
 void windowResize(int width, int height) {
-  // Calculate aspect ratio for proper perspective
-  float aspect = static_cast<float>(width) / static_cast<float>(height);
+  // The simulation builds the projection matrix for this size
+  windowWidth = std::max(width, 1);
+  windowHeight = std::max(height, 1);
 
   // Update viewport to match new window dimensions
   glViewport(0, 0, width, height);
 
-  // Update projection matrix
-  glMatrixMode(GL_PROJECTION);
-  glLoadIdentity();
-  gluPerspective(sceneConfig.camera.fov, aspect, sceneConfig.camera.nearPlane,
-                 sceneConfig.camera.farPlane);
-
-  // Return to modelview mode
-  glMatrixMode(GL_MODELVIEW);
-  glLoadIdentity();
-
   // Update ImGui for the new dimensions
   ImGui_ImplGLUT_ReshapeFunc(width, height);
 }
@@ -120,6 +125,41 @@ void renderCoordinateSystem() {
   }
 }
 
+/**
+ * Outlines the world bounds of the selected model or instance
+ */
+void renderSelection(const FramePacket& frame) {
+  if (!frame.selection.hit()) {
+    return;
+  }
+
+  const AABB& box = frame.selection_bounds;
+  glm::vec3 corners[2] = {box.min, box.max};
+
+  glDisable(GL_LIGHTING);
+  glDisable(GL_TEXTURE_2D);
+  glBegin(GL_LINES);
+  glColor3f(1.0f, 1.0f, 0.0f);
+  // Each edge joins two corners that differ along one axis
+  for (int corner = 0; corner < 8; corner++) {
+    for (int axis = 0; axis < 3; axis++) {
+      if (corner & (1 << axis)) continue;
+      int other = corner | (1 << axis);
+      glVertex3f(corners[corner & 1].x, corners[(corner >> 1) & 1].y,
+                 corners[(corner >> 2) & 1].z);
+      glVertex3f(corners[other & 1].x, corners[(other >> 1) & 1].y,
+                 corners[(other >> 2) & 1].z);
+    }
+  }
+  glColor3f(1.0f, 1.0f, 1.0f);
+  glEnd();
+  glEnable(GL_TEXTURE_2D);
+
+  if (sceneConfig.lights.size() != 0) {
+    glEnable(GL_LIGHTING);
+  }
+}
+
 /**
  * Initializes the scene from a file
  *
@@ -128,21 +168,21 @@ void renderCoordinateSystem() {
 void initializeScene(char* filePath) {
   sceneFile.assign(filePath);
 
-  // Parse scene based on file extension
-  if (sceneFile.substr(sceneFile.size() - 4) == ".xml") {
-    sceneConfig = parseConfig(sceneFile);
-  } else if (sceneFile.substr(sceneFile.size() - 3) == ".3d") {
-    sceneConfig = parseConfig3D(sceneFile);
-  } else if (sceneFile.substr(sceneFile.size() - 4) == ".obj") {
-    sceneConfig = parseConfigObj(sceneFile);
-  } else {
-    std::cout << "Unsupported file format: " << sceneFile << std::endl;
-    std::cout << "Supported formats: .xml, .3d, .obj" << std::endl;
-    exit(1);
-  }
+  sceneConfig = parseSceneFile(sceneFile, &jobSystem);
+}
 
-  // Initialize camera from scene configuration
-  mainCamera = sceneConfig.camera;
+/**
+ * Prints how much memory the loaded scene takes from its arena (--stats)
+ */
+void printSceneStats() {
+  if (!sceneConfig.arena) {
+    return;
+  }
+  const SceneArena& arena = *sceneConfig.arena;
+  std::cout << "Scene arena: " << arena.allocations() << " allocations ("
+            << arena.bytesRequested() / 1024 << " KiB requested), peak "
+            << arena.bytesReserved() / 1024 << " KiB in " << arena.blocks()
+            << " heap blocks" << std::endl;
 }
 
 /**
@@ -152,16 +192,25 @@ void initializeScene(char* filePath) {
  */
 void prepareModels(ModelGroup& modelCollection) {
   // Process all models in the current group
-  for (Model& mesh : modelCollection.models) {
+  for (Model& model : modelCollection.models) {
     modelCountTotal++;
-    mesh.initModel();
+    initModel(model);
 
     // Store statistics for UI display
     MeshStats stats = {
-        static_cast<int>(mesh.vbo.size()),     // Vertex count
-        static_cast<int>(mesh.ibo.size() / 3)  // Triangle count (indices / 3)
+        static_cast<int>(model.mesh->vbo.size()),     // Vertex count
+        static_cast<int>(model.mesh->ibo.size() / 3)  // Triangle count
     };
-    modelStatistics[mesh.filename] = stats;
+    modelStatistics[model.filename] = stats;
+  }
+
+  // Instance sets count every copy, but hold a single model
+  for (InstanceSet& set : modelCollection.instances) {
+    modelCountTotal += static_cast<int>(set.size());
+    initModel(set.model);
+    modelStatistics[set.model.filename] = {
+        static_cast<int>(set.model.mesh->vbo.size()),
+        static_cast<int>(set.model.mesh->ibo.size() / 3)};
   }
 
   // Recursively process all subgroups
@@ -171,31 +220,139 @@ void prepareModels(ModelGroup& modelCollection) {
 }
 
 /**
- * Reloads the scene from the current scene file
+ * Reloads the scene from the current scene file. Only called between
+ * frames, since it drops the packet the frame draws
  */
 void reloadScene() {
+  // The simulation reads the scene graph that is about to be rebuilt
+  simulation.stop();
+
   // Reset statistics
   modelCountTotal = 0;
   modelStatistics.clear();
 
   // Re-initialize scene and models
   initializeScene(const_cast<char*>(sceneFile.c_str()));
+  if (showSceneStats) {
+    printSceneStats();
+  }
   prepareModels(sceneConfig.modelGroup);
+  releaseTextures();
+  sceneGraph.build(sceneConfig.modelGroup);
   enableLighting = setupLights(sceneConfig.lights);
+  simulation.start(sceneGraph, sceneConfig.camera);
 }
 
 /**
  * Restores the camera to its initial configuration
  */
 void restoreCamera() {
-  mainCamera = sceneConfig.camera;
+  simulation.resetCamera();
   animationSpeed = 1.0f;
 }
 
+/**
+ * Shows the picked model or instance: its group, transforms, material and
+ * mesh
+ */
+void displayInspector(const FramePacket& frame) {
+  const PickResult& selection = frame.selection;
+  bool instance = selection.model < 0;
+  int node = instance ? sceneGraph.instance_node[selection.set]
+                      : sceneGraph.model_node[selection.model];
+  const ModelGroup& group = *sceneGraph.groups[node];
+  const Model& model = instance ? sceneGraph.instance_sets[selection.set]->model
+                                : *sceneGraph.models[selection.model];
+
+  // Path from the root, with unnamed groups shown by node index
+  std::string path;
+  for (int n = node; n >= 0; n = sceneGraph.parent[n]) {
+    const std::pmr::string& name = sceneGraph.groups[n]->name;
+    std::string step = name.empty() ? "#" + std::to_string(n)
+                                    : std::string(name.begin(), name.end());
+    path = path.empty() ? step : step + " / " + path;
+  }
+
+  ImGui::Begin("Selection", NULL, ImGuiWindowFlags_AlwaysAutoResize);
+  ImGui::Text("Group: %s",
+              group.name.empty() ? "(unnamed)" : group.name.c_str());
+  ImGui::Text("Path: %s", path.c_str());
+  if (instance) {
+    ImGui::Text("Instance %d of %zu", selection.instance,
+                sceneGraph.instance_sets[selection.set]->size());
+  }
+  ImGui::Text("Hit triangle %d at distance %.3f (picked in %.3f ms)",
+              selection.triangle, selection.distance, frame.pick_ms);
+
+  if (ImGui::CollapsingHeader("Transforms", ImGuiTreeNodeFlags_DefaultOpen)) {
+    size_t s = 0, r = 0, t = 0;
+    for (Transformations type : group.order) {
+      switch (type) {
+        case STATIC: {
+          const glm::mat4& matrix = group.static_transformations[s++];
+          ImGui::BulletText(
+              "Static: translation (%.2f, %.2f, %.2f) scale (%.2f, %.2f, "
+              "%.2f)",
+              matrix[3].x, matrix[3].y, matrix[3].z,
+              glm::length(glm::vec3(matrix[0])),
+              glm::length(glm::vec3(matrix[1])),
+              glm::length(glm::vec3(matrix[2])));
+        } break;
+        case TIMEROTATION: {
+          const TimeRotations& rotation = group.rotations[r++];
+          ImGui::BulletText("Rotation: every %.2f s around (%.2f, %.2f, %.2f)",
+                            rotation.time, rotation.x, rotation.y, rotation.z);
+        } break;
+        case TIMETRANSLATE: {
+          const TimeTranslations& curve = group.translates[t++];
+          ImGui::BulletText("Curve: every %.2f s through %zu points%s%s",
+                            curve.time, curve.curvePoints.size(),
+                            curve.align ? ", aligned" : "",
+                            curve.constant_speed ? ", constant speed" : "");
+        } break;
+      }
+    }
+    const glm::mat4& world = frame.selection_world;
+    ImGui::Text("World position: (%.3f, %.3f, %.3f)", world[3].x, world[3].y,
+                world[3].z);
+  }
+
+  if (ImGui::CollapsingHeader("Material", ImGuiTreeNodeFlags_DefaultOpen)) {
+    const Material& m = model.material;
+    ImGui::Text("Ambient:  (%.2f, %.2f, %.2f)", m.ambient.x, m.ambient.y,
+                m.ambient.z);
+    ImGui::Text("Diffuse:  (%.2f, %.2f, %.2f)", m.diffuse.x, m.diffuse.y,
+                m.diffuse.z);
+    ImGui::Text("Specular: (%.2f, %.2f, %.2f)", m.specular.x, m.specular.y,
+                m.specular.z);
+    ImGui::Text("Emissive: (%.2f, %.2f, %.2f)", m.emission.x, m.emission.y,
+                m.emission.z);
+    ImGui::Text("Shininess: %.1f", m.shininess);
+    ImGui::Text("Texture: %s", model.texture_filepath.empty()
+                                   ? "(none)"
+                                   : model.texture_filepath.c_str());
+  }
+
+  if (ImGui::CollapsingHeader("Mesh", ImGuiTreeNodeFlags_DefaultOpen)) {
+    const Mesh& mesh = *model.mesh;
+    glm::vec3 size = mesh.bounds.max - mesh.bounds.min;
+    ImGui::Text("File: %s", model.filename.c_str());
+    ImGui::Text("Vertices: %zu Triangles: %zu", mesh.vbo.size(),
+                mesh.ibo.size() / 3);
+    ImGui::Text("Size: %.3f x %.3f x %.3f", size.x, size.y, size.z);
+    ImGui::Text("Shared by %ld models", model.mesh.use_count() - 1);
+  }
+
+  if (ImGui::Button("Clear Selection")) {
+    simulation.clearSelection();
+  }
+  ImGui::End();
+}
+
 /**
  * Renders the ImGui-based user interface
  */
-void displayUI() {
+void displayUI(const FramePacket& frame) {
   // Initialize new frame
   ImGui_ImplOpenGL3_NewFrame();
   ImGui_ImplGLUT_NewFrame();
@@ -212,8 +369,9 @@ void displayUI() {
                 1000.f / guiState.Framerate);
 
     // Camera information
-    ImGui::Text("Camera Position: (%.3f, %.3f, %.3f)", mainCamera.position.x,
-                mainCamera.position.y, mainCamera.position.z);
+    ImGui::Text("Camera Position: (%.3f, %.3f, %.3f)",
+                frame.camera.position.x, frame.camera.position.y,
+                frame.camera.position.z);
 
     // View frustum information
     ImGui::Text("FOV: %d Aspect Ratio: %.1f Near: %.3f Far: %.3f",
@@ -225,6 +383,10 @@ void displayUI() {
     // Scene information
     ImGui::Text("Scene File: %s", sceneFile.c_str());
     ImGui::Text("Models: %d (Total %d)", modelCountVisible, modelCountTotal);
+    ImGui::Text("Matrices recomputed: %d (Groups %zu)",
+                frame.matrices_recomputed, sceneGraph.size());
+    ImGui::Text("BVH: %zu nodes, build %.3f ms, refit %.3f ms",
+                frame.bvh_nodes, frame.bvh_build_ms, frame.bvh_refit_ms);
 
     // Toggle model statistics panel
     ImGui::Checkbox("Model Statistics", &showModelDetails);
@@ -243,9 +405,18 @@ void displayUI() {
     ImGui::Checkbox("Show Normals", &showNormals);
     ImGui::SameLine();
     ImGui::Checkbox("Enable Lighting", &enableLighting);
+    ImGui::Checkbox("Frustum Culling", &frustumCulling);
 
-    // Animation controls
+    // Animation controls, applied by the next simulation step
     ImGui::SliderFloat("Animation Speed", &animationSpeed, 0.0f, 2.0f);
+    ImGui::Checkbox("Pause", &animationPaused);
+    ImGui::SameLine();
+    ImGui::Checkbox("Fixed Timestep (1/120 s)", &fixedTimestep);
+    float animationTime = static_cast<float>(frame.time);
+    if (ImGui::DragFloat("Animation Time", &animationTime, 0.1f, 0.0f,
+                         0.0f)) {
+      simulation.scrubTo(animationTime);
+    }
 
     // Reset and reload buttons
     ImGui::Button("Reset View", ImVec2(80, 20));
@@ -255,7 +426,7 @@ void displayUI() {
     ImGui::SameLine();
     ImGui::Button("Reload Scene", ImVec2(100, 20));
     if (ImGui::IsItemClicked()) {
-      reloadScene();
+      reloadRequested = true;
     }
     ImGui::End();
   }
@@ -272,6 +443,11 @@ void displayUI() {
     ImGui::End();
   }
 
+  // Inspector for the model or instance picked with the mouse
+  if (frame.selection.hit()) {
+    displayInspector(frame);
+  }
+
   // Render ImGui
   ImGui::Render();
   glViewport(0, 0, (GLsizei)guiState.DisplaySize.x,
@@ -291,54 +467,45 @@ void setRenderMode() {
 }
 
 /**
- * Calculates time elapsed since last frame
- *
- * @return Time elapsed in seconds
- */
-inline float calculateFrameTime() {
-  static auto previousTime = std::chrono::high_resolution_clock::now();
-  const auto currentTime = std::chrono::high_resolution_clock::now();
-
-  // Calculate elapsed time in milliseconds
-  const auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
-                             currentTime - previousTime)
-                             .count();
-
-  previousTime = currentTime;
-
-  // Return time in seconds
-  return elapsedMs / 1000.0f;
-}
-
-/**
- * Updates scene state based on user input
- */
-void updateScene() {
-  // Process input events
-  Input::process_input();
-
-  // Update camera using controller
-  static CameraController camControl(mainCamera);
-  float deltaTime = calculateFrameTime();
-  camControl.update(deltaTime, showUI);
-}
-
-/**
- * Main render function called each frame
+ * Main render function called each frame. Draws the newest frame packet of
+ * the simulation, which meanwhile goes on with the next ones
  */
 void renderFrame() {
-  // Update scene logic
-  updateScene();
+  // Before taking a packet: reloading rebuilds the graph the packets index
+  // into, and the packets of the old scene are dropped with it
+  if (reloadRequested) {
+    reloadRequested = false;
+    reloadScene();
+  }
+
+  // Hand the UI's settings to the next simulation step
+  SimulationSettings settings;
+  settings.speed = animationSpeed;
+  settings.paused = animationPaused;
+  settings.fixed_step = fixedTimestep;
+  settings.culling = frustumCulling;
+  // Clicks over the UI belong to it
+  settings.ui_has_mouse =
+      simulation.showUI() && ImGui::GetIO().WantCaptureMouse;
+  settings.width = windowWidth;
+  settings.height = windowHeight;
+  simulation.setSettings(settings);
 
   // Clear buffers
   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-  glLoadIdentity();
 
-  // Set up camera view
-  glm::vec3 viewTarget = mainCamera.position + mainCamera.forward;
-  gluLookAt(mainCamera.position.x, mainCamera.position.y, mainCamera.position.z,
-            viewTarget.x, viewTarget.y, viewTarget.z, mainCamera.up.x,
-            mainCamera.up.y, mainCamera.up.z);
+  const FramePacket* frame = simulation.acquire();
+  if (!frame) {
+    glutSwapBuffers();
+    glutPostRedisplay();
+    return;
+  }
+
+  // Set up the camera the frame was simulated with
+  glMatrixMode(GL_PROJECTION);
+  glLoadMatrixf(&frame->projection[0][0]);
+  glMatrixMode(GL_MODELVIEW);
+  glLoadMatrixf(&frame->view[0][0]);
 
   // Configure rendering mode
   setRenderMode();
@@ -352,13 +519,14 @@ void renderFrame() {
   }
 
   // Draw all models in the scene
-  modelCountVisible = 0;
-  sceneConfig.modelGroup.drawGroup(enableLighting, showNormals, animationSpeed,
-                                   modelCountVisible);
+  FrameStats frameStats;
+  drawFrame(sceneGraph, *frame, enableLighting, showNormals, frameStats);
+  renderSelection(*frame);
+  modelCountVisible = frameStats.draw_calls;
 
   // Draw UI if enabled
-  if (showUI) {
-    displayUI();
+  if (simulation.showUI()) {
+    displayUI(*frame);
   }
 
   // Swap buffers and request next frame
@@ -376,6 +544,8 @@ void parseArguments(int argCount, char** argValues) {
   for (int i = 2; i < argCount; i++) {
     if (strcmp(argValues[i], "-s") == 0) {
       basicMode = true;
+    } else if (strcmp(argValues[i], "--stats") == 0) {
+      showSceneStats = true;
     }
   }
 }
@@ -393,21 +563,42 @@ int main(int argc, char** argv) {
     std::cout << "Invalid Parameters\n";
     std::cout << "Usage: ./build/engine/Debug/engine <scene_file> [options]\n";
     std::cout << "Options:\n";
-    std::cout << "  -s    Basic mode (simplified rendering)\n";
+    std::cout << "  -s       Basic mode (simplified rendering)\n";
+    std::cout << "  --stats  Print scene memory statistics\n";
+    std::cout << "Benchmark: ./build/engine/Debug/engine --bench <scene_file> "
+                 "[--frames N] [--resolution WxH] [--timestep S] "
+                 "[--threads N] [--output results.csv|results.json]\n";
     return 1;
   }
 
+  // Deterministic offscreen benchmark
+  if (strcmp(argv[1], "--bench") == 0) {
+    BenchOptions benchOptions;
+    if (!parseBenchArguments(argc, argv, benchOptions)) {
+      std::cout << "Usage: engine --bench <scene_file> [--frames N] "
+                   "[--resolution WxH] [--timestep S] [--threads N] "
+                   "[--cull] [--output file]\n";
+      return 1;
+    }
+    return runBenchmark(benchOptions);
+  }
+
   // Initialize scene from file
   initializeScene(argv[1]);
 
   // Parse additional command line arguments
   parseArguments(argc, argv);
+  if (showSceneStats) {
+    printSceneStats();
+  }
 
   // Initialize GLUT
   glutInit(&argc, argv);
   glutInitDisplayMode(GLUT_DEPTH | GLUT_DOUBLE | GLUT_RGBA);
   glutInitWindowPosition(100, 100);
   glutInitWindowSize(sceneConfig.window.width, sceneConfig.window.height);
+  windowWidth = std::max(sceneConfig.window.width, 1);
+  windowHeight = std::max(sceneConfig.window.height, 1);
   glutCreateWindow("3D Scene Renderer");
 
   // Initialize GLEW and OpenGL state
@@ -441,11 +632,16 @@ int main(int argc, char** argv) {
   // Set up scene
   enableLighting = setupLights(sceneConfig.lights);
   prepareModels(sceneConfig.modelGroup);
+  releaseTextures();
+  sceneGraph.build(sceneConfig.modelGroup);
+  sceneGraph.setJobSystem(&jobSystem);
+  simulation.start(sceneGraph, sceneConfig.camera);
 
   // Enter main loop
   glutMainLoop();
 
   // Clean up resources
+  simulation.stop();
   shutDownMenu();
 
   return 0;
@@ -9,59 +9,96 @@
 #include "menuGUI.hpp"
 
 void Input::on_key_down(unsigned char native_key, int x, int y) {
-  s_keyboard_state[native_to_key(native_key)] = true;
+  {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_live.keyboard[native_to_key(native_key)] = true;
+  }
   ImGui_ImplGLUT_KeyboardFunc(native_key, x, y);
 }
 
 void Input::on_key_up(unsigned char native_key, int x, int y) {
-  s_keyboard_state[native_to_key(native_key)] = false;
+  {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_live.keyboard[native_to_key(native_key)] = false;
+  }
   ImGui_ImplGLUT_KeyboardUpFunc(native_key, x, y);
 }
 
 void Input::on_special_key_down(int native_key, int x, int y) {
-  s_keyboard_state[special_native_to_key(native_key)] = true;
+  {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_live.keyboard[special_native_to_key(native_key)] = true;
+  }
   ImGui_ImplGLUT_SpecialFunc(native_key, x, y);
 }
 
 void Input::on_special_key_up(int native_key, int x, int y) {
-  s_keyboard_state[special_native_to_key(native_key)] = false;
+  {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_live.keyboard[special_native_to_key(native_key)] = false;
+  }
   ImGui_ImplGLUT_SpecialUpFunc(native_key, x, y);
 }
 
 void Input::on_mouse_motion(int x, int y) {
-  s_mouse_position = glm::ivec2{x, y};
+  {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_live.mouse_position = glm::ivec2{x, y};
+  }
   ImGui_ImplGLUT_MotionFunc(x, y);
 }
 
 void Input::on_mouse_button(int native_button, int state, int x, int y) {
-  s_mouse_state[native_to_button(native_button)] = GLUT_DOWN == state;
+  {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_live.mouse[native_to_button(native_button)] = GLUT_DOWN == state;
+    if (native_to_button(native_button) == Mouse::Left && GLUT_DOWN == state) {
+      s_live.click_pending = true;
+      s_live.click_position = glm::ivec2{x, y};
+    }
+  }
   ImGui_ImplGLUT_MouseFunc(native_button, state, x, y);
 }
 
+bool Input::consume_click(glm::ivec2& position) {
+  if (!s_state.click_pending) {
+    return false;
+  }
+  s_state.click_pending = false;
+  position = s_state.click_position;
+  return true;
+}
+
 void Input::process_input() {
-  static glm::ivec2 prev_position = s_mouse_position;
-  s_mouse_delta = s_mouse_position - prev_position;
-  prev_position = s_mouse_position;
+  {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_state = s_live;
+    s_live.click_pending = false;
+  }
+
+  static glm::ivec2 prev_position = s_state.mouse_position;
+  s_mouse_delta = s_state.mouse_position - prev_position;
+  prev_position = s_state.mouse_position;
 }
 
 bool Input::is_down(Keyboard::Key key) {
-  assert(key < s_keyboard_state.size());
-  return s_keyboard_state.test(key);
+  assert(key < s_state.keyboard.size());
+  return s_state.keyboard.test(key);
 }
 
 bool Input::is_up(Keyboard::Key key) {
-  assert(key < s_keyboard_state.size());
-  return !s_keyboard_state.test(key);
+  assert(key < s_state.keyboard.size());
+  return !s_state.keyboard.test(key);
 }
 
 bool Input::is_down(Mouse::Button button) {
-  assert(button < s_mouse_state.size());
-  return s_mouse_state.test(button);
+  assert(button < s_state.mouse.size());
+  return s_state.mouse.test(button);
 }
 
 bool Input::is_up(Mouse::Button button) {
-  assert(button < s_mouse_state.size());
-  return !s_mouse_state.test(button);
+  assert(button < s_state.mouse.size());
+  return !s_state.mouse.test(button);
 }
 
 Keyboard::Key Input::native_to_key(unsigned char key_code) {
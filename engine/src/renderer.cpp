@@ -0,0 +1,347 @@
+#include <GL/glew.h>
+extern "C" {
+#include <GL/gl.h>
+#ifdef __APPLE_CC__
+#include <GLUT/glut.h>
+#else
+#include <GL/freeglut.h>
+#endif
+}
+
+#include "renderer.hpp"
+
+#include <glm/gtc/type_ptr.hpp>
+#include <iostream>
+#include <memory>
+
+#include "readFile.hpp"
+
+/**
+ * Extracts position coordinates from vertices into a flat vector
+ */
+static std::vector<float> extractPositions(
+    const std::vector<Vertex>& vertices) {
+  std::vector<float> result;
+  result.reserve(vertices.size() * 3);
+
+  for (const Vertex& vertex : vertices) {
+    result.push_back(vertex.position.x);
+    result.push_back(vertex.position.y);
+    result.push_back(vertex.position.z);
+  }
+  return result;
+}
+
+/**
+ * Extracts normal vectors from vertices into a flat vector
+ */
+static std::vector<float> extractNormals(const std::vector<Vertex>& vertices) {
+  std::vector<float> result;
+  result.reserve(vertices.size() * 3);
+
+  for (const Vertex& vertex : vertices) {
+    result.push_back(vertex.normal.x);
+    result.push_back(vertex.normal.y);
+    result.push_back(vertex.normal.z);
+  }
+  return result;
+}
+
+/**
+ * Extracts texture coordinates from vertices into a flat vector
+ */
+static std::vector<float> extractTexCoords(
+    const std::vector<Vertex>& vertices) {
+  std::vector<float> result;
+  result.reserve(vertices.size() * 2);
+
+  for (const Vertex& vertex : vertices) {
+    result.push_back(vertex.texture.x);
+    result.push_back(vertex.texture.y);
+  }
+  return result;
+}
+
+/**
+ * Setup vertex, normal, texture, and index buffers for the mesh
+ */
+static void uploadMesh(Mesh& mesh) {
+  std::vector<float> positions = extractPositions(mesh.vbo);
+  std::vector<float> normals = extractNormals(mesh.vbo);
+  std::vector<float> texCoords = extractTexCoords(mesh.vbo);
+
+  // Generate and configure vertex position buffer
+  glGenBuffers(1, &mesh.vertex_buffer);
+  glBindBuffer(GL_ARRAY_BUFFER, mesh.vertex_buffer);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(float) * positions.size(),
+               positions.data(), GL_STATIC_DRAW);
+
+  // Generate and configure vertex normal buffer
+  glGenBuffers(1, &mesh.normal_buffer);
+  glBindBuffer(GL_ARRAY_BUFFER, mesh.normal_buffer);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(float) * normals.size(), normals.data(),
+               GL_STATIC_DRAW);
+
+  // Generate and configure texture coordinate buffer
+  glGenBuffers(1, &mesh.texture_buffer);
+  glBindBuffer(GL_ARRAY_BUFFER, mesh.texture_buffer);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(float) * texCoords.size(),
+               texCoords.data(), GL_STATIC_DRAW);
+
+  // Generate and configure index buffer
+  glGenBuffers(1, &mesh.index_buffer);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.index_buffer);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * mesh.ibo.size(),
+               mesh.ibo.data(), GL_STATIC_DRAW);
+
+  mesh.uploaded = true;
+}
+
+/**
+ * Load texture from file and configure OpenGL texture parameters
+ */
+static bool loadTexture(Model& model) {
+  // Load image data, usually decoded already while the scene was parsed
+  std::shared_ptr<const TextureImage> image =
+      readTexture(model.texture_filepath);
+
+  // Debug information
+  std::cout << "Loading texture: " << model.texture_filepath << std::endl;
+
+  if (!image) {
+    std::cerr << "Failed to load texture: " << model.texture_filepath
+              << std::endl;
+    return false;
+  }
+
+  // Generate and bind texture
+  glGenTextures(1, &model.texture_id);
+  glBindTexture(GL_TEXTURE_2D, model.texture_id);
+
+  // Set texture parameters
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+  // Use mipmapping for better quality at different distances
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                  GL_LINEAR_MIPMAP_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+  // Ensure proper alignment when uploading
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+  // Upload texture data to GPU
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image->width, image->height, 0,
+               GL_RGBA, GL_UNSIGNED_BYTE, image->pixels);
+  glGenerateMipmap(GL_TEXTURE_2D);
+
+  // Unbind the texture
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  return true;
+}
+
+/**
+ * Uploads the model's mesh and texture if not already done
+ */
+void initModel(Model& model) {
+  if (model.initialized) {
+    return;
+  }
+  model.initialized = true;
+
+  // The shared mesh may have been uploaded by another model using it
+  if (!model.mesh->uploaded) {
+    uploadMesh(*model.mesh);
+  }
+
+  if (!model.texture_filepath.empty()) {
+    bool textureLoaded = loadTexture(model);
+    if (!textureLoaded) {
+      std::cerr << "Error: Failed to load texture file: "
+                << model.texture_filepath << std::endl;
+    }
+  }
+}
+
+/**
+ * Binds the texture and the mesh buffers for drawing
+ */
+void bindModel(Model& model) {
+  initModel(model);
+
+  // Bind texture
+  glBindTexture(GL_TEXTURE_2D, model.texture_id);
+
+  // Configure vertex positions
+  glBindBuffer(GL_ARRAY_BUFFER, model.mesh->vertex_buffer);
+  glVertexPointer(3, GL_FLOAT, 0, 0);
+
+  // Configure vertex normals
+  glBindBuffer(GL_ARRAY_BUFFER, model.mesh->normal_buffer);
+  glNormalPointer(GL_FLOAT, 0, 0);
+
+  // Configure texture coordinates
+  glBindBuffer(GL_ARRAY_BUFFER, model.mesh->texture_buffer);
+  glTexCoordPointer(2, GL_FLOAT, 0, 0);
+
+  // Set default color and bind the indices
+  glColor3f(1.0, 1.0, 1.0);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, model.mesh->index_buffer);
+}
+
+/**
+ * Draw the model using OpenGL
+ */
+void drawModel(Model& model) {
+  bindModel(model);
+  glDrawElements(GL_TRIANGLES, model.mesh->ibo.size(), GL_UNSIGNED_INT, 0);
+
+  // Unbind texture
+  glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+/**
+ * Visualize vertex normals for debugging purposes
+ */
+void drawNormals(const Model& model) {
+  glDisable(GL_LIGHTING);
+  glColor3f(1.0, 0.0, 0.0);
+
+  for (const Vertex& vertex : model.mesh->vbo) {
+    glBegin(GL_LINES);
+    // Start point at vertex position
+    glVertex3f(vertex.position.x, vertex.position.y, vertex.position.z);
+    // End point in normal direction
+    glVertex3f(vertex.position.x + vertex.normal.x,
+               vertex.position.y + vertex.normal.y,
+               vertex.position.z + vertex.normal.z);
+    glEnd();
+  }
+
+  glEnable(GL_LIGHTING);
+}
+
+void setupMaterial(const Material& m) {
+  glMaterialfv(GL_FRONT, GL_AMBIENT, glm::value_ptr(m.ambient));
+  glMaterialfv(GL_FRONT, GL_DIFFUSE, glm::value_ptr(m.diffuse));
+  glMaterialfv(GL_FRONT, GL_SPECULAR, glm::value_ptr(m.specular));
+  glMaterialfv(GL_FRONT, GL_EMISSION, glm::value_ptr(m.emission));
+  glMaterialf(GL_FRONT, GL_SHININESS, m.shininess);
+}
+
+bool setupLights(const std::vector<Light>& lights) {
+  if (lights.size() != 0) {
+    glEnable(GL_RESCALE_NORMAL);
+    float amb[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+
+    glLightModelfv(GL_LIGHT_MODEL_AMBIENT, amb);
+    glEnable(GL_LIGHTING);
+    for (int i = 0; i < lights.size(); i++) {
+      float white[4] = {1.0, 1.0, 1.0, 1.0};
+
+      glEnable(GL_LIGHT0 + i);
+      glLightfv(GL_LIGHT0 + i, GL_DIFFUSE, white);
+      glLightfv(GL_LIGHT0 + i, GL_SPECULAR, white);
+    }
+    return true;
+  }
+
+  return false;
+}
+
+void drawLights(const std::vector<Light>& lights) {
+  for (int i = 0; i < lights.size() && lights.size() < 8; i++) {
+    const Light& light = lights[i];
+
+    switch (light.type) {
+      case DIRECTIONAL: {
+        float direction[4] = {light.direction.x, light.direction.y,
+                              light.direction.z, 0.0f};
+        glLightfv(GL_LIGHT0 + i, GL_POSITION, direction);
+        break;
+      }
+      case POINT: {
+        float position[4] = {light.position.x, light.position.y,
+                             light.position.z, 1.0f};
+        glLightfv(GL_LIGHT0 + i, GL_POSITION, position);
+        break;
+      }
+      case SPOT: {
+        float postion[4] = {light.position.x, light.position.y,
+                            light.position.z, 1.0f};
+        glLightfv(GL_LIGHT0 + i, GL_POSITION, postion);
+        float direction[4] = {light.direction.x, light.direction.y,
+                              light.direction.z, 0.0f};
+        glLightfv(GL_LIGHT0 + i, GL_SPOT_DIRECTION, direction);
+        glLightf(GL_LIGHT0 + i, GL_SPOT_CUTOFF, light.cutoff);
+        break;
+      }
+    }
+  }
+}
+
+/**
+ * Draws a model with its material, counting it in the frame statistics
+ */
+static void drawSceneModel(Model& model, bool lights, bool normals,
+                           FrameStats& stats) {
+  if (lights) {
+    setupMaterial(model.material);
+  }
+  stats.draw_calls++;
+  stats.triangles += model.mesh->ibo.size() / 3;
+  drawModel(model);
+  if (normals) drawNormals(model);
+}
+
+void drawFrame(const SceneGraph& graph, const FramePacket& frame, bool lights,
+               bool normals, FrameStats& stats) {
+  if (frame.culled) {
+    for (int m : frame.visible) {
+      glPushMatrix();
+      glMultMatrixf(&frame.world[graph.model_node[m]][0][0]);
+      drawSceneModel(*graph.models[m], lights, normals, stats);
+      glPopMatrix();
+    }
+  } else {
+    for (size_t node = 0; node < graph.size(); node++) {
+      if (graph.model_count[node] == 0) {
+        continue;
+      }
+
+      glPushMatrix();
+      glMultMatrixf(&frame.world[node][0][0]);
+
+      int end = graph.model_begin[node] + graph.model_count[node];
+      for (int m = graph.model_begin[node]; m < end; m++) {
+        drawSceneModel(*graph.models[m], lights, normals, stats);
+      }
+
+      glPopMatrix();
+    }
+  }
+
+  // Instance sets are drawn under the world matrix of their node
+  for (size_t i = 0; i < graph.instance_sets.size(); i++) {
+    glPushMatrix();
+    glMultMatrixf(&frame.world[graph.instance_node[i]][0][0]);
+    drawInstanceSet(*graph.instance_sets[i], frame.instances[i], frame.frame,
+                    lights, stats);
+    glPopMatrix();
+  }
+}
+
+void drawCatmullRomCurve(TimeTranslations& translation) {
+  float global_t = 0.0f;
+  const int steps = 100;
+  float step_size = translation.time / steps;
+
+  glBegin(GL_LINE_LOOP);
+  for (int i = 0; i < steps; ++i) {
+    auto [pos, _] = translation.getLocation(global_t);
+    glVertex3f(pos.x, pos.y, pos.z);
+    global_t += step_size;
+  }
+  glEnd();
+}
@@ -0,0 +1,163 @@
+#include "simulation.hpp"
+
+#include <chrono>
+
+#include "picking.hpp"
+#include "process_input.hpp"
+
+void Simulation::start(SceneGraph& graph, const Camera& camera) {
+  stop();
+
+  _graph = &graph;
+  _bvh.clear();
+  _initialCamera = camera;
+  _camera = camera;
+  _controller.emplace(_camera);
+  _selection = PickResult();
+  _packets.reset();
+  _hasPacket = false;
+
+  _stop = false;
+  _thread = std::thread(&Simulation::run, this);
+}
+
+void Simulation::stop() {
+  if (!_thread.joinable()) {
+    return;
+  }
+  _stop = true;
+  _thread.join();
+}
+
+const FramePacket* Simulation::acquire() {
+  if (_packets.acquire()) {
+    _hasPacket = true;
+  }
+  return _hasPacket ? &_packets.front() : nullptr;
+}
+
+void Simulation::setSettings(const SimulationSettings& settings) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _settings = settings;
+}
+
+void Simulation::scrubTo(double time) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _scrubTo = time;
+}
+
+void Simulation::resetCamera() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _resetCamera = true;
+}
+
+void Simulation::clearSelection() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _clearSelection = true;
+}
+
+/**
+ * Steps at RATE until stopped. A step that runs late is not made up for,
+ * so the clock, not the step count, keeps the animation on time
+ */
+void Simulation::run() {
+  using Clock = std::chrono::steady_clock;
+  const Clock::duration period =
+      std::chrono::duration_cast<Clock::duration>(
+          std::chrono::duration<double>(STEP));
+
+  Clock::time_point next = Clock::now();
+  while (!_stop) {
+    step();
+
+    next += period;
+    Clock::time_point now = Clock::now();
+    if (next < now) {
+      next = now;
+    }
+    std::this_thread::sleep_until(next);
+  }
+}
+
+void Simulation::step() {
+  // Settings and requests from the UI since the last step
+  SimulationSettings settings;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    settings = _settings;
+    if (_scrubTo) {
+      _clock.scrubTo(*_scrubTo);
+      _scrubTo.reset();
+    }
+    if (_resetCamera) {
+      _camera = _initialCamera;
+      _controller.emplace(_camera);
+      _resetCamera = false;
+    }
+    if (_clearSelection) {
+      _selection = PickResult();
+      _clearSelection = false;
+    }
+  }
+
+  _clock.setScale(settings.speed);
+  _clock.setPaused(settings.paused);
+  _clock.setFixedStep(settings.fixed_step ? STEP : 0.0);
+  _clock.tick();
+
+  // Input and camera
+  Input::process_input();
+  bool showUI = _showUI;
+  _controller->update(_clock.delta(), showUI);
+  _showUI = showUI;
+
+  // Transforms and bounds
+  FrameStats stats;
+  _graph->update(_clock.time(), stats);
+  if (!_bvh.built()) {
+    _bvh.build(*_graph);
+  } else {
+    _bvh.refit(*_graph);
+  }
+
+  FramePacket& packet = _packets.back();
+  float aspect = static_cast<float>(settings.width) /
+                 static_cast<float>(settings.height);
+  packet.camera = _camera;
+  packet.projection = _camera.getProjectionMatrix(aspect);
+  packet.view = _camera.getViewMatrix();
+  glm::mat4 viewProjection = packet.projection * packet.view;
+
+  // Clicks over the UI belong to it
+  glm::ivec2 click;
+  if (Input::consume_click(click) && !settings.ui_has_mouse) {
+    auto start = std::chrono::steady_clock::now();
+    Ray ray = cursorRay(viewProjection, glm::vec2(click),
+                        glm::vec2(settings.width, settings.height));
+    _selection = pick(*_graph, _bvh, ray);
+    _pickMs = std::chrono::duration<double, std::milli>(
+                  std::chrono::steady_clock::now() - start)
+                  .count();
+  }
+  packet.selection = _selection;
+  if (_selection.model >= 0) {
+    packet.selection_bounds = _bvh.bounds(_selection.model);
+  } else if (_selection.set >= 0) {
+    packet.selection_bounds = _bvh.bounds(
+        _bvh.instanceItem(_selection.set, _selection.instance));
+  }
+  packet.selection_world = pickedWorld(*_graph, _selection);
+  packet.pick_ms = _pickMs;
+
+  captureFrame(*_graph, _clock.time(), packet);
+  packet.culled = settings.culling;
+  if (settings.culling) {
+    cullFrame(_bvh, Frustum(viewProjection), packet);
+  }
+  packet.frame = ++_frame;
+  packet.matrices_recomputed = stats.matrices_recomputed;
+  packet.bvh_nodes = _bvh.nodeCount();
+  packet.bvh_build_ms = _bvh.buildMs();
+  packet.bvh_refit_ms = _bvh.refitMs();
+  _packets.publish();
+}
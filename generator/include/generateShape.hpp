@@ -0,0 +1,32 @@
+#ifndef GENERATESHAPE_HPP
+#define GENERATESHAPE_HPP
+
+#include <string>
+#include <vector>
+
+/**
+ * A figure to generate, as written on the command line: the figure name,
+ * its inputs and the output file, optionally followed by "-s" for the
+ * simple format and "--stream" to write it while it is generated
+ */
+struct ShapeSpec {
+  std::vector<std::string> args;  // Figure name, inputs and output file
+  bool advanced = true;
+  bool stream = false;
+
+  const std::string& output() const { return args.back(); }
+
+  // Where the figure is saved, see modelPath
+  std::string outputPath() const;
+};
+
+ShapeSpec parseShapeSpec(std::vector<std::string> args);
+
+/**
+ * Generates the figure and saves it
+ *
+ * @return False if the arguments are invalid or the file couldn't be written
+ */
+bool generateShape(const ShapeSpec& spec);
+
+#endif  // GENERATESHAPE_HPP
@@ -0,0 +1,17 @@
+#ifndef MANIFEST_HPP
+#define MANIFEST_HPP
+
+/**
+ * Generates every figure listed in a manifest, on all hardware threads.
+ *
+ * Each line holds the arguments of one figure as they would be given to the
+ * generator, for example "sphere 1 20 20 sphere.3d"; empty lines and lines
+ * starting with '#' are ignored. A hash of each line, and of the input file
+ * for patches, is kept in "<manifest>.cache", and figures whose file exists
+ * with the same hash are skipped. Prints the time each figure took.
+ *
+ * @return False if any figure couldn't be generated
+ */
+bool generateManifest(const char* manifestPath);
+
+#endif  // MANIFEST_HPP
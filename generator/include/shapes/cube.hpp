@@ -1,12 +0,0 @@
-#ifndef CUBE_HPP
-#define CUBE_HPP
-
-#include <string>
-#include <vector>
-
-#include "utils.hpp"
-
-bool generateCubeTriangles(float length, int divisions, const char* filepath,
-                           bool advanced);
-
-#endif  // CUBE_HPP
\ No newline at end of file
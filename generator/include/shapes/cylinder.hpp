@@ -1,11 +0,0 @@
-#ifndef CYLINDER_HPP
-#define CYLINDER_HPP
-
-#include <string>
-
-#include "cylinder.hpp"
-
-bool generateCylinderTriangles(float radius, float height, int slices,
-                               const char* filepath, bool advanced);
-
-#endif  // CYLINDER_HPP
@@ -1,11 +0,0 @@
-#ifndef SOLAR_SYSTEM_PLANE_HPP
-#define SOLAR_SYSTEM_PLANE_HPP
-
-#include <string>
-
-#include "utils.hpp"
-
-bool generatePlaneTriangles(float length, int divisions, const char* filepath,
-                            bool advanced);
-
-#endif  // SOLAR_SYSTEM_PLANE_HPP
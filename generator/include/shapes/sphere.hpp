@@ -1,12 +0,0 @@
-#ifndef SOLAR_SYSTEM_SPHERE_HPP
-#define SOLAR_SYSTEM_SPHERE_HPP
-
-#include <string>
-#include <vector>
-
-#include "utils.hpp"
-
-bool generateSphereTriangles(float radius, int slices, int stacks,
-                             const char* filepath, bool advanced);
-
-#endif  // SOLAR_SYSTEM_SPHERE_HPP
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include "generateShape.hpp"
+
+#include <charconv>
+#include <iostream>
+
+#include "save3dFile.hpp"
+#include "shapeBuilder.hpp"
+#include "shapes/patches.hpp"
+
+std::string ShapeSpec::outputPath() const {
+  return modelPath(output().c_str(), advanced);
+}
+
+ShapeSpec parseShapeSpec(std::vector<std::string> args) {
+  ShapeSpec spec;
+  // --stream writes the figure to disk as it is generated
+  if (!args.empty() && args.back() == "--stream") {
+    spec.stream = true;
+    args.pop_back();
+  }
+  // -s after the output file selects the simple format
+  if (!args.empty() && args.back() == "-s") {
+    spec.advanced = false;
+    args.pop_back();
+  }
+  spec.args = std::move(args);
+  return spec;
+}
+
+bool generateShape(const ShapeSpec& spec) {
+  const std::vector<std::string>& args = spec.args;
+  if (args.size() < 2) {
+    std::cerr << "Insufficient arguments\n";
+    return false;
+  }
+
+  // The figure's parameters lie between its name and the output file
+  const std::string& shapeName = args[0];
+  std::vector<std::string> values(args.begin() + 1, args.end() - 1);
+
+  // Times the grid tessellation against evaluating every quad on its own
+  if (shapeName == "patch" && spec.output() == "--benchmark") {
+    int tessellation = 0;
+    if (values.size() == 2) {
+      const std::string& level = values[1];
+      const char* end = level.data() + level.size();
+      auto [last, status] = std::from_chars(level.data(), end, tessellation);
+      if (status != std::errc() || last != end) {
+        tessellation = 0;
+      }
+    }
+    if (tessellation <= 0) {
+      std::cerr << "Invalid arguments\n";
+      return false;
+    }
+    benchmarkPatches(values[0].c_str(), tessellation);
+    return true;
+  }
+
+  // Checked before the output file is opened, the values by buildShape
+  if (!shapeParameters(shapeName)) {
+    std::cerr << "Unknown figure: " << shapeName << std::endl;
+    return false;
+  }
+
+  std::cout << "Generating " << shapeName << std::endl;
+  return saveMesh(spec.output().c_str(), spec.advanced, spec.stream,
+                  [&](MeshSink& mesh) {
+                    return buildShape(shapeName, values, mesh);
+                  });
+}
@@ -0,0 +1,231 @@
+#include "manifest.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include "generateShape.hpp"
+#include "jobs.hpp"
+
+// Changing it regenerates every figure, for when the output format changes
+static const char* MANIFEST_VERSION = "indexed-1";
+
+enum class JobResult { Generated, UpToDate, Failed };
+
+struct ManifestJob {
+  int line;
+  ShapeSpec spec;
+  uint64_t hash = 0;
+  JobResult result = JobResult::Failed;
+  double milliseconds = 0;
+};
+
+/**
+ * Discards what the figures print while they are generated together
+ */
+class NullBuffer : public std::streambuf {
+ protected:
+  int overflow(int c) override { return c; }
+  std::streamsize xsputn(const char*, std::streamsize count) override {
+    return count;
+  }
+};
+
+// 64-bit FNV-1a
+static uint64_t hashBytes(uint64_t hash, const char* data, size_t size) {
+  for (size_t i = 0; i < size; i++) {
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+static uint64_t hashString(uint64_t hash, const std::string& text) {
+  // Includes the terminator, so "ab c" and "a bc" differ
+  return hashBytes(hash, text.c_str(), text.size() + 1);
+}
+
+/**
+ * Hash of everything the figure's file depends on, or 0 if an input file
+ * can't be read
+ */
+static uint64_t specHash(const ShapeSpec& spec) {
+  uint64_t hash = hashString(0xcbf29ce484222325ull, MANIFEST_VERSION);
+  for (const std::string& arg : spec.args) {
+    hash = hashString(hash, arg);
+  }
+  hash = hashString(hash, spec.advanced ? "indexed" : "simple");
+
+  if (spec.args[0] == "patch" || spec.args[0] == "adaptivepatch") {
+    std::ifstream input(spec.args[1], std::ios::binary);
+    if (!input.is_open()) {
+      return 0;
+    }
+    std::stringstream contents;
+    contents << input.rdbuf();
+    hash = hashString(hash, contents.str());
+  }
+  return hash;
+}
+
+static std::map<std::string, uint64_t> readCache(const std::string& path) {
+  std::map<std::string, uint64_t> cache;
+  std::ifstream file(path);
+  std::string output;
+  uint64_t hash;
+  while (file >> std::hex >> hash >> std::ws && std::getline(file, output)) {
+    cache[output] = hash;
+  }
+  return cache;
+}
+
+static void writeCache(const std::string& path,
+                       const std::map<std::string, uint64_t>& cache) {
+  std::ofstream file(path);
+  if (!file.is_open()) {
+    std::cerr << "Error writing " << path << std::endl;
+    return;
+  }
+  for (const auto& [output, hash] : cache) {
+    file << std::hex << std::setw(16) << std::setfill('0') << hash << ' '
+         << output << '\n';
+  }
+}
+
+static bool readManifest(const char* manifestPath,
+                         std::vector<ManifestJob>& jobs) {
+  std::ifstream file(manifestPath);
+  if (!file.is_open()) {
+    std::cerr << "Error opening manifest " << manifestPath << std::endl;
+    return false;
+  }
+
+  std::set<std::string> outputs;
+  std::string line;
+  for (int number = 1; std::getline(file, line); number++) {
+    std::istringstream lineStream(line);
+    std::vector<std::string> args;
+    for (std::string arg; lineStream >> arg;) {
+      args.push_back(arg);
+    }
+    if (args.empty() || args[0][0] == '#') {
+      continue;
+    }
+
+    ManifestJob job{number, parseShapeSpec(std::move(args))};
+    if (job.spec.args.size() < 2) {
+      std::cerr << manifestPath << ":" << number << ": Insufficient arguments"
+                << std::endl;
+      return false;
+    }
+    // Two lines writing one file would race and never be up to date
+    if (!outputs.insert(job.spec.outputPath()).second) {
+      std::cerr << manifestPath << ":" << number << ": "
+                << job.spec.outputPath() << " is already generated by another"
+                << " line" << std::endl;
+      return false;
+    }
+    jobs.push_back(std::move(job));
+  }
+  return true;
+}
+
+static const char* resultName(JobResult result) {
+  switch (result) {
+    case JobResult::Generated:
+      return "generated";
+    case JobResult::UpToDate:
+      return "up to date";
+    default:
+      return "FAILED";
+  }
+}
+
+bool generateManifest(const char* manifestPath) {
+  using Clock = std::chrono::steady_clock;
+  auto start = Clock::now();
+
+  std::vector<ManifestJob> jobs;
+  if (!readManifest(manifestPath, jobs)) {
+    return false;
+  }
+
+  std::string cachePath = std::string(manifestPath) + ".cache";
+  std::map<std::string, uint64_t> cache = readCache(cachePath);
+
+  std::vector<ManifestJob*> pending;
+  for (ManifestJob& job : jobs) {
+    job.hash = specHash(job.spec);
+    auto cached = cache.find(job.spec.outputPath());
+    if (job.hash != 0 && cached != cache.end() && cached->second == job.hash &&
+        std::filesystem::exists(job.spec.outputPath())) {
+      job.result = JobResult::UpToDate;
+    } else {
+      pending.push_back(&job);
+    }
+  }
+
+  // The figures print as they go, which would only interleave here
+  NullBuffer nullBuffer;
+  std::streambuf* coutBuffer = std::cout.rdbuf(&nullBuffer);
+  runJobs(pending.size(), [&](size_t i) {
+    ManifestJob& job = *pending[i];
+    auto jobStart = Clock::now();
+    try {
+      if (generateShape(job.spec)) {
+        job.result = JobResult::Generated;
+      }
+    } catch (const std::exception& e) {
+      std::cerr << manifestPath << ":" << job.line
+                << ": Invalid arguments: " << e.what() << std::endl;
+    }
+    job.milliseconds =
+        std::chrono::duration<double, std::milli>(Clock::now() - jobStart)
+            .count();
+  });
+  std::cout.rdbuf(coutBuffer);
+
+  int generated = 0, upToDate = 0, failed = 0;
+  double jobMilliseconds = 0;
+  std::cout << std::fixed << std::setprecision(1);
+  for (const ManifestJob& job : jobs) {
+    switch (job.result) {
+      case JobResult::Generated:
+        generated++;
+        cache[job.spec.outputPath()] = job.hash;
+        break;
+      case JobResult::UpToDate:
+        upToDate++;
+        break;
+      case JobResult::Failed:
+        failed++;
+        cache.erase(job.spec.outputPath());
+        break;
+    }
+    jobMilliseconds += job.milliseconds;
+    std::cout << std::setw(4) << job.line << "  " << std::setw(8)
+              << job.spec.args[0] << "  " << std::setw(24) << job.spec.output()
+              << "  " << std::setw(10) << resultName(job.result) << "  "
+              << std::setw(9) << job.milliseconds << " ms\n";
+  }
+  writeCache(cachePath, cache);
+
+  unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+  double totalMilliseconds =
+      std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  std::cout << generated << " generated, " << upToDate << " up to date, "
+            << failed << " failed in " << totalMilliseconds << " ms ("
+            << jobMilliseconds << " ms of generation on " << threads
+            << (threads == 1 ? " thread)" : " threads)") << std::endl;
+  std::cout.unsetf(std::ios::floatfield);
+  return failed == 0;
+}
@@ -0,0 +1,129 @@
+import argparse
+import json
+import sys
+
+# Compares two result files of the bench target and fails if a benchmark got
+# slower than the threshold allows:
+#   ./build/bench/bench --benchmark_out=results.json --benchmark_repetitions=5
+#   python3 scripts/compare_bench.py bench/baseline.json results.json
+# With repetitions, the medians are compared, otherwise the fastest run.
+# Benchmarks that count allocations also fail if they allocate more, and
+# any benchmark that reports an error fails the comparison.
+
+UNITS = {"ns": 1e-9, "us": 1e-6, "ms": 1e-3, "s": 1.0}
+COUNTERS = ("allocations", "bytes")
+
+
+def read_times(file_path):
+    """Time of each benchmark in seconds, by name"""
+    with open(file_path) as file:
+        benchmarks = json.load(file)["benchmarks"]
+
+    medians, fastest = {}, {}
+    for benchmark in benchmarks:
+        if benchmark.get("error_occurred"):
+            continue
+        name = benchmark.get("run_name", benchmark["name"])
+        time = benchmark["real_time"] * UNITS[benchmark.get("time_unit", "ns")]
+        if benchmark.get("run_type") == "aggregate":
+            if benchmark.get("aggregate_name") == "median":
+                medians[name] = time
+        else:
+            fastest[name] = min(time, fastest.get(name, time))
+    return {**fastest, **medians}
+
+
+def read_counters(file_path):
+    """Allocation counters of each benchmark that reports them, by name"""
+    with open(file_path) as file:
+        benchmarks = json.load(file)["benchmarks"]
+
+    counters = {}
+    for benchmark in benchmarks:
+        if benchmark.get("error_occurred"):
+            continue
+        if benchmark.get("run_type") == "aggregate" and \
+                benchmark.get("aggregate_name") != "median":
+            continue
+        name = benchmark.get("run_name", benchmark["name"])
+        for counter in COUNTERS:
+            if counter in benchmark:
+                counters[(name, counter)] = benchmark[counter]
+    return counters
+
+
+def read_errors(file_path):
+    """Names of the benchmarks that reported an error, with the message"""
+    with open(file_path) as file:
+        benchmarks = json.load(file)["benchmarks"]
+    return {benchmark.get("run_name", benchmark["name"]):
+            benchmark.get("error_message", "")
+            for benchmark in benchmarks if benchmark.get("error_occurred")}
+
+
+def format_time(seconds):
+    for unit in ("s", "ms", "us", "ns"):
+        if seconds >= UNITS[unit] or unit == "ns":
+            return f"{seconds / UNITS[unit]:.3g} {unit}"
+
+
+def compare_bench(baseline_path, results_path, threshold):
+    baseline = read_times(baseline_path)
+    results = read_times(results_path)
+
+    regressions = []
+    width = max(map(len, list(baseline) + list(results) + ["Benchmark"]))
+    print(f"{'Benchmark':<{width}}  {'Baseline':>10}  {'Current':>10}  Change")
+    for name, time in results.items():
+        if name not in baseline:
+            print(f"{name:<{width}}  {'-':>10}  {format_time(time):>10}  new")
+            continue
+        change = time / baseline[name] - 1
+        flag = ""
+        if change > threshold:
+            flag = "  SLOWER"
+            regressions.append(name)
+        elif change < -threshold:
+            flag = "  faster"
+        print(f"{name:<{width}}  {format_time(baseline[name]):>10}  "
+              f"{format_time(time):>10}  {change:+7.1%}{flag}")
+    for name in baseline:
+        if name not in results:
+            print(f"{name:<{width}}  {format_time(baseline[name]):>10}  "
+                  f"{'-':>10}  missing")
+
+    # Allocation counts don't depend on the machine, so any growth past the
+    # threshold means the code allocates more
+    grown = []
+    baseline_counters = read_counters(baseline_path)
+    for (name, counter), value in read_counters(results_path).items():
+        before = baseline_counters.get((name, counter))
+        if before and value / before - 1 > threshold:
+            print(f"{name}: {counter} grew from {before:.0f} to {value:.0f}")
+            grown.append(name)
+
+    errors = read_errors(results_path)
+    for name, message in errors.items():
+        print(f"{name}: {message}")
+
+    if regressions:
+        print(f"\n{len(regressions)} benchmarks are more than "
+              f"{threshold:.0%} slower than the baseline")
+    if grown:
+        print(f"\n{len(grown)} allocation counters are more than "
+              f"{threshold:.0%} above the baseline")
+    if errors:
+        print(f"\n{len(errors)} benchmarks failed")
+    return not regressions and not grown and not errors
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Compare bench results against a baseline")
+    parser.add_argument("baseline", help="JSON results of the baseline")
+    parser.add_argument("results", help="JSON results to check")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="slowdown allowed, as a fraction (default 0.10)")
+    args = parser.parse_args()
+    sys.exit(0 if compare_bench(args.baseline, args.results,
+                                args.threshold) else 1)
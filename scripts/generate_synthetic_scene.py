@@ -0,0 +1,56 @@
+import math
+import random
+import sys
+
+# Writes a scene with many independently animated bodies, used to measure
+# transform update throughput:
+#   python3 scripts/generate_synthetic_scene.py 100000 scenes/synthetic.xml
+#   ./build/engine/Debug/engine --bench scenes/synthetic.xml --threads 1
+def generate_synthetic_scene(num_bodies=100000, file_path="synthetic.xml", seed=42):
+    random.seed(seed)
+    lines = [
+        '<world>\n',
+        '    <window width="1280" height="720" />\n',
+        '    <camera>\n',
+        '        <position x="0" y="80" z="120" />\n',
+        '        <lookAt x="0" y="0" z="0" />\n',
+        '        <up x="0" y="1" z="0" />\n',
+        '        <projection fov="60" near="0.1" far="1000" />\n',
+        '    </camera>\n',
+        '    <group name="Synthetic">\n',
+    ]
+
+    for i in range(num_bodies):
+        radius = random.uniform(10, 100)
+        height = random.uniform(-2, 2)
+        period = random.uniform(10, 120)
+        spin = random.uniform(1, 10)
+        scale = random.uniform(0.05, 0.3)
+
+        lines.append(f'        <group name="Body{i}">\n')
+        lines.append(f'            <transform>\n')
+        lines.append(f'                <translate time="{period:.3f}" align="true">\n')
+        for k in range(4):
+            angle = k * math.pi / 2
+            lines.append(f'                    <point x="{radius * math.cos(angle):.3f}" y="{height:.3f}" z="{radius * math.sin(angle):.3f}" />\n')
+        lines.append(f'                </translate>\n')
+        lines.append(f'                <rotate time="{spin:.3f}" x="0" y="1" z="0" />\n')
+        lines.append(f'                <scale x="{scale:.3f}" y="{scale:.3f}" z="{scale:.3f}" />\n')
+        lines.append(f'            </transform>\n')
+        lines.append(f'            <models>\n')
+        lines.append(f'                <model file="sphere_low_res.3d" />\n')
+        lines.append(f'            </models>\n')
+        lines.append(f'        </group>\n')
+
+    lines.append('    </group>\n')
+    lines.append('</world>\n')
+
+    with open(file_path, "w") as file:
+        file.writelines(lines)
+
+    print(f"Synthetic scene written to {file_path} ({num_bodies} bodies).")
+
+if __name__ == "__main__":
+    count = int(sys.argv[1]) if len(sys.argv) > 1 else 100000
+    path = sys.argv[2] if len(sys.argv) > 2 else "synthetic.xml"
+    generate_synthetic_scene(count, path)
@@ -0,0 +1,54 @@
+#ifndef INDEXEDMESH_HPP
+#define INDEXEDMESH_HPP
+
+#include <vector>
+
+#include "utils.hpp"
+
+/**
+ * Receives the vertices and triangles of a shape as it is generated.
+ * Triangles only refer to vertices added before them.
+ */
+class MeshSink {
+ public:
+  virtual ~MeshSink() = default;
+
+  // Vertices added so far, which is the index of the next one
+  virtual size_t vertexCount() const = 0;
+
+  // Returns the index of the new vertex
+  virtual unsigned int addVertex(const Point& point, const Point& normal,
+                                 const Point2D& texture) = 0;
+
+  virtual void addTriangle(unsigned int a, unsigned int b, unsigned int c) = 0;
+};
+
+/**
+ * Triangles over a list of shared vertices, kept in memory.
+ *
+ * Each vertex has a position, a normal and texture coordinates, and every
+ * three indices make a triangle. A grid of quads shares each inner vertex
+ * between the six triangles around it instead of repeating it.
+ */
+struct IndexedMesh : public MeshSink {
+  std::vector<Point> points;
+  std::vector<Point> normals;
+  std::vector<Point2D> textures;
+  std::vector<unsigned int> indices;
+
+  size_t vertexCount() const override { return points.size(); }
+  size_t triangleCount() const { return indices.size() / 3; }
+
+  unsigned int addVertex(const Point& point, const Point& normal,
+                         const Point2D& texture) override;
+
+  void addTriangle(unsigned int a, unsigned int b, unsigned int c) override;
+
+  // Adds every vertex and triangle to another sink
+  void copyTo(MeshSink& sink) const;
+
+  // Corners of every triangle in order, as in the simple .3d format
+  std::vector<Point> trianglePoints() const;
+};
+
+#endif  // INDEXEDMESH_HPP
@@ -0,0 +1,33 @@
+#ifndef JOBS_HPP
+#define JOBS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/**
+ * Runs job(0) … job(count - 1) on every hardware thread, each thread taking
+ * the next job until none are left
+ */
+template <typename Job>
+void runJobs(size_t count, const Job& job) {
+  std::atomic<size_t> next{0};
+  auto worker = [&] {
+    for (size_t i = next++; i < count; i = next++) {
+      job(i);
+    }
+  };
+  size_t threadCount = std::min<size_t>(
+      std::max(1u, std::thread::hardware_concurrency()), count);
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < threadCount; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+#endif  // JOBS_HPP
@@ -0,0 +1,105 @@
+#ifndef SAVE3D_HPP
+#define SAVE3D_HPP
+
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "fileWriter.hpp"
+#include "indexedMesh.hpp"
+#include "utils.hpp"
+
+/**
+ * Where a shape is saved: the file name under models/ for the indexed
+ * format, the whole given path under models/ for the simple one
+ */
+std::string modelPath(const char* filepath, bool advanced);
+
+/**
+ * Writes a mesh in the indexed .3d format: a "# indexed <vertices>
+ * <triangles>" header, a "v x y z nx ny nz u v" line per vertex, then an
+ * "f a b c" line of zero-based vertex indices per triangle
+ *
+ * @return False if the file couldn't be written
+ */
+bool save3DAdvancedfile(const IndexedMesh& mesh, const char* filepath);
+
+/**
+ * Writes each vertex and triangle of a shape to disk as soon as it is
+ * generated, to the same path and in the same format as save3DAdvancedfile
+ * or, for the simple format, saveToFile.
+ *
+ * In the indexed format the "v" and "f" lines come in the order they were
+ * generated, and the header counts are filled in by close(). Memory use
+ * does not grow with the mesh, except that the simple format keeps every
+ * position to write the triangle corners out.
+ */
+class MeshFileWriter : public MeshSink {
+ public:
+  MeshFileWriter(const char* filepath, bool advanced);
+
+  bool isOpen() const { return _file.isOpen(); }
+
+  size_t vertexCount() const override { return _vertexCount; }
+
+  unsigned int addVertex(const Point& point, const Point& normal,
+                         const Point2D& texture) override;
+
+  void addTriangle(unsigned int a, unsigned int b, unsigned int c) override;
+
+  // Completes the file. @return False if it couldn't be written
+  bool close();
+
+  // Closes and deletes the file, for a shape that couldn't be built
+  void discard();
+
+ private:
+  FileWriter _file;
+  std::string _path;
+  bool _advanced;
+  size_t _vertexCount = 0, _triangleCount = 0;
+  std::vector<Point> _points;  // Simple format only
+};
+
+/**
+ * Runs generate(MeshSink&) and saves the shape it builds, either streaming
+ * it to disk or collecting it in an IndexedMesh first. If generate returns
+ * false, nothing is saved and a streamed file is deleted
+ */
+template <typename Generate>
+bool saveMesh(const char* filepath, bool advanced, bool stream,
+              const Generate& generate) {
+  auto build = [&](MeshSink& sink) {
+    if constexpr (std::is_void_v<decltype(generate(sink))>) {
+      generate(sink);
+      return true;
+    } else {
+      return static_cast<bool>(generate(sink));
+    }
+  };
+
+  if (stream) {
+    MeshFileWriter writer(filepath, advanced);
+    if (!writer.isOpen()) {
+      return false;
+    }
+    if (!build(writer)) {
+      writer.discard();
+      return false;
+    }
+    return writer.close();
+  }
+
+  IndexedMesh mesh;
+  if (!build(mesh)) {
+    return false;
+  }
+  if (advanced) {
+    return save3DAdvancedfile(mesh, filepath);
+  }
+  saveToFile(mesh.trianglePoints(), filepath);
+  return true;
+}
+
+#endif  // SAVE3D_HPP
@@ -0,0 +1,25 @@
+#ifndef SHAPEBUILDER_HPP
+#define SHAPEBUILDER_HPP
+
+#include <string>
+#include <vector>
+
+#include "indexedMesh.hpp"
+
+/**
+ * Names of the parameters of a figure, in the order the generator takes
+ * them, or null if there is no such figure. A patch takes the patch file
+ * and the tessellation level.
+ */
+const std::vector<std::string>* shapeParameters(const std::string& shape);
+
+/**
+ * Builds a figure in memory from the values of its parameters, written as
+ * on the generator's command line
+ *
+ * @return False if there is no such figure or a value is invalid
+ */
+bool buildShape(const std::string& shape,
+                const std::vector<std::string>& values, MeshSink& mesh);
+
+#endif  // SHAPEBUILDER_HPP
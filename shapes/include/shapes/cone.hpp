@@ -0,0 +1,17 @@
+#ifndef CONE_HPP
+#define CONE_HPP
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "indexedMesh.hpp"
+#include "utils.hpp"
+
+// Builds the cone as a base fan and stacks of rings up to the apex
+void coneTriangles(const float baseRadius, const float coneHeight,
+                   const size_t numSlices, const size_t numStacks,
+                   MeshSink& cone);
+
+#endif  // CONE_HPP
\ No newline at end of file
@@ -0,0 +1,13 @@
+#ifndef CUBE_HPP
+#define CUBE_HPP
+
+#include <string>
+#include <vector>
+
+#include "indexedMesh.hpp"
+#include "utils.hpp"
+
+// Builds the cube as a grid of shared vertices on each face
+void cubeAllPoints(float length, int divisions, MeshSink& cube);
+
+#endif  // CUBE_HPP
\ No newline at end of file
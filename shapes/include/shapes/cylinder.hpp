@@ -0,0 +1,13 @@
+#ifndef CYLINDER_HPP
+#define CYLINDER_HPP
+
+#include <string>
+
+#include "indexedMesh.hpp"
+#include "utils.hpp"
+
+// Builds the cylinder as its two caps and a side of shared vertices
+void calculateCylinder(const float radius, const float height,
+                       const int slices, MeshSink& cylinder);
+
+#endif  // CYLINDER_HPP
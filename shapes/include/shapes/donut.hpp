@@ -0,0 +1,14 @@
+#ifndef DONUT_HPP
+#define DONUT_HPP
+
+#include <string>
+#include <vector>
+
+#include "indexedMesh.hpp"
+#include "utils.hpp"
+
+// Builds the torus as a grid of (rings + 1) x (sides + 1) shared vertices
+void donutAllPoints(float majorRadius, float minorRadius, int sides, int rings,
+                    MeshSink& torus);
+
+#endif  // DONUT_HPP
\ No newline at end of file
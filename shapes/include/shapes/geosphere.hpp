@@ -0,0 +1,28 @@
+#ifndef GEOSPHERE_HPP
+#define GEOSPHERE_HPP
+
+#include "indexedMesh.hpp"
+#include "utils.hpp"
+
+/**
+ * Spheres with evenly sized triangles, tessellated to a maximum chordal
+ * error: the largest distance between the sphere and its triangles.
+ *
+ * The icosphere splits each edge of an icosahedron into the same number of
+ * parts, and the cube sphere each face of a cube into a square grid, spaced
+ * by equal angles. Both are projected onto the sphere, share every vertex
+ * and map textures like the UV sphere, with the vertices on the seam and at
+ * the poles repeated.
+ */
+
+// Fewest parts per icosahedron edge that keep the error under maxError
+int icosphereSubdivisions(float radius, float maxError);
+
+// Fewest grid cells per cube edge that keep the error under maxError
+int cubeSphereSubdivisions(float radius, float maxError);
+
+void generateIcosphere(float radius, int subdivisions, MeshSink& sphere);
+
+void generateCubeSphere(float radius, int subdivisions, MeshSink& sphere);
+
+#endif  // GEOSPHERE_HPP
@@ -0,0 +1,71 @@
+#ifndef PATCHES_HPP
+#define PATCHES_HPP
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "indexedMesh.hpp"
+#include "utils.hpp"
+
+// Control points of a bicubic patch, indexed [u * 4 + v]
+using PatchPoints = std::array<Point, 16>;
+
+/**
+ * Reads a .patch file: the patch count, 16 control point indices per patch,
+ * then the control points
+ */
+bool readPatchFile(const char* bezier_patch, std::vector<PatchPoints>& patches);
+
+IndexedMesh patchTriangles(const char* bezier_patch, const int tessellation);
+
+/**
+ * Splits every patch into tessellation² quads of two triangles, on several
+ * threads. Each patch is evaluated once per vertex of its
+ * (tessellation + 1)² grid, as B·G·Bᵀ with the Bernstein basis tabulated
+ * for the level, and the quads index into the shared grid.
+ */
+IndexedMesh tessellatePatches(const std::vector<PatchPoints>& patches,
+                              const int tessellation);
+
+/**
+ * Same as above, passing the patches to a sink a batch at a time so that
+ * only one batch is held in memory
+ */
+void tessellatePatches(const std::vector<PatchPoints>& patches,
+                       const int tessellation, MeshSink& mesh);
+
+/**
+ * Tessellates every patch only as finely as its curvature needs for the
+ * triangles to stay within maxError of the surface, so flat patches get few
+ * triangles. Each side of a patch is split by its own control points alone,
+ * the same way by both patches that share it, and a strip of triangles
+ * stitches the sides to the grid inside, so there are no cracks.
+ */
+void tessellatePatchesAdaptive(const std::vector<PatchPoints>& patches,
+                               float maxError, MeshSink& mesh);
+
+/**
+ * The same triangles as a soup, with every quad evaluating its own corners
+ * through bezierPatch. Kept as the reference for benchmarkPatches.
+ */
+std::pair<std::pair<std::vector<Point>, std::vector<Point>>,
+          std::vector<Point2D>>
+tessellatePatchesDirect(const std::vector<PatchPoints>& patches,
+                        const int tessellation);
+
+/**
+ * Times both tessellations of a patch file and prints how far apart their
+ * vertices and normals are
+ */
+void benchmarkPatches(const char* bezier_patch, const int tessellation);
+
+float bernstein(int i, float t);
+
+Point bezierPatch(const PatchPoints& controlPoints, float u, float v);
+
+float bernsteinDerivative(int i, float t);
+
+Point calculateNormal(const Point& p1, const Point& p2, const Point& p3);
+
+#endif  // PATCHES_HPP
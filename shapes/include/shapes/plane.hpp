@@ -0,0 +1,12 @@
+#ifndef SOLAR_SYSTEM_PLANE_HPP
+#define SOLAR_SYSTEM_PLANE_HPP
+
+#include <string>
+
+#include "indexedMesh.hpp"
+#include "utils.hpp"
+
+// Builds the plane as a grid of (divisions + 1)² shared vertices
+void generatePlaneData(float size, int divisions, MeshSink& plane);
+
+#endif  // SOLAR_SYSTEM_PLANE_HPP
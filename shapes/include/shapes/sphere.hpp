@@ -0,0 +1,14 @@
+#ifndef SOLAR_SYSTEM_SPHERE_HPP
+#define SOLAR_SYSTEM_SPHERE_HPP
+
+#include <string>
+#include <vector>
+
+#include "indexedMesh.hpp"
+#include "utils.hpp"
+
+// Builds the sphere as a grid of (slices + 1) x (stacks + 1) shared vertices
+void generateSpherePoints(float radius, int slices, int stacks,
+                          MeshSink& sphere);
+
+#endif  // SOLAR_SYSTEM_SPHERE_HPP
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include "indexedMesh.hpp"
+
+unsigned int IndexedMesh::addVertex(const Point& point, const Point& normal,
+                                    const Point2D& texture) {
+  points.push_back(point);
+  normals.push_back(normal);
+  textures.push_back(texture);
+  return static_cast<unsigned int>(points.size() - 1);
+}
+
+void IndexedMesh::addTriangle(unsigned int a, unsigned int b,
+                              unsigned int c) {
+  indices.push_back(a);
+  indices.push_back(b);
+  indices.push_back(c);
+}
+
+void IndexedMesh::copyTo(MeshSink& sink) const {
+  unsigned int offset = static_cast<unsigned int>(sink.vertexCount());
+  for (size_t i = 0; i < points.size(); i++) {
+    sink.addVertex(points[i], normals[i], textures[i]);
+  }
+  for (size_t i = 0; i < indices.size(); i += 3) {
+    sink.addTriangle(indices[i] + offset, indices[i + 1] + offset,
+                     indices[i + 2] + offset);
+  }
+}
+
+std::vector<Point> IndexedMesh::trianglePoints() const {
+  std::vector<Point> corners;
+  corners.reserve(indices.size());
+  for (unsigned int index : indices) {
+    corners.push_back(points[index]);
+  }
+  return corners;
+}
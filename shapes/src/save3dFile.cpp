@@ -0,0 +1,122 @@
+#include "save3dFile.hpp"
+
+#include <cstdio>
+
+// Room left in a streamed header for the counts, filled in at the end
+static const size_t HEADER_LENGTH = 64;
+
+std::string modelPath(const char* filepath, bool advanced) {
+  std::string path(filepath);
+  if (!advanced) {
+    return "models/" + path;
+  }
+  std::string modelsPath = "./models/";
+  return modelsPath + path.substr(path.find_last_of('/') + 1);
+}
+
+static void writeVertex(FileWriter& file, const Point& point,
+                        const Point& normal, const Point2D& texture) {
+  file << "v " << point.x << ' ' << point.y << ' ' << point.z << ' '
+       << normal.x << ' ' << normal.y << ' ' << normal.z << ' ' << texture.x
+       << ' ' << texture.y << '\n';
+}
+
+static void writeTriangle(FileWriter& file, unsigned int a, unsigned int b,
+                          unsigned int c) {
+  file << "f " << a << ' ' << b << ' ' << c << '\n';
+}
+
+bool save3DAdvancedfile(const IndexedMesh& mesh, const char* filepath) {
+  // Prepend /models/ to the filepath
+  std::string newPath = modelPath(filepath, true);
+  std::cout << "Saving to: " << newPath << std::endl;
+
+  // Open the file for writing
+  FileWriter file(newPath);
+  if (!file.isOpen()) {
+    std::cerr << "Error opening file" << std::endl;
+    return false;
+  }
+
+  file << "# indexed " << mesh.vertexCount() << ' ' << mesh.triangleCount()
+       << '\n';
+
+  for (size_t i = 0; i < mesh.vertexCount(); i++) {
+    writeVertex(file, mesh.points[i], mesh.normals[i], mesh.textures[i]);
+  }
+
+  for (size_t i = 0; i < mesh.indices.size(); i += 3) {
+    writeTriangle(file, mesh.indices[i], mesh.indices[i + 1],
+                  mesh.indices[i + 2]);
+  }
+
+  if (!file.close()) {
+    std::cerr << "Error writing " << newPath << std::endl;
+    return false;
+  }
+  return true;
+}
+
+MeshFileWriter::MeshFileWriter(const char* filepath, bool advanced)
+    : _advanced(advanced) {
+  _path = modelPath(filepath, advanced);
+  std::cout << "Streaming to: " << _path << std::endl;
+
+  if (!_file.open(_path)) {
+    std::cerr << "Error opening file" << std::endl;
+    return;
+  }
+  if (advanced) {
+    _file << std::string(HEADER_LENGTH - 1, ' ') << '\n';
+  }
+}
+
+unsigned int MeshFileWriter::addVertex(const Point& point, const Point& normal,
+                                       const Point2D& texture) {
+  if (_advanced) {
+    writeVertex(_file, point, normal, texture);
+  } else {
+    _points.push_back(point);
+  }
+  return static_cast<unsigned int>(_vertexCount++);
+}
+
+void MeshFileWriter::addTriangle(unsigned int a, unsigned int b,
+                                 unsigned int c) {
+  _triangleCount++;
+  if (_advanced) {
+    writeTriangle(_file, a, b, c);
+    return;
+  }
+  for (unsigned int index : {a, b, c}) {
+    const Point& point = _points[index];
+    _file << point.x << ' ' << point.y << ' ' << point.z << '\n';
+  }
+}
+
+bool MeshFileWriter::close() {
+  if (!_file.isOpen()) {
+    return false;
+  }
+
+  if (_advanced) {
+    char header[HEADER_LENGTH];
+    std::snprintf(header, sizeof(header), "# indexed %zu %zu", _vertexCount,
+                  _triangleCount);
+    _file.seek(0);
+    _file << header;
+  }
+
+  if (!_file.close()) {
+    std::cerr << "Error writing " << _path << std::endl;
+    return false;
+  }
+  std::cout << "Wrote " << _vertexCount << " vertices and " << _triangleCount
+            << " triangles" << std::endl;
+  return true;
+}
+
+void MeshFileWriter::discard() {
+  _file.close();
+  std::remove(_path.c_str());
+}
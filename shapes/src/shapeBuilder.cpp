@@ -0,0 +1,119 @@
+#include "shapeBuilder.hpp"
+
+#include <charconv>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <set>
+
+#include "shapes/cone.hpp"
+#include "shapes/cube.hpp"
+#include "shapes/cylinder.hpp"
+#include "shapes/donut.hpp"
+#include "shapes/geosphere.hpp"
+#include "shapes/patches.hpp"
+#include "shapes/plane.hpp"
+#include "shapes/sphere.hpp"
+
+static const std::map<std::string, std::vector<std::string>> PARAMETERS = {
+    {"sphere", {"radius", "slices", "stacks"}},
+    {"icosphere", {"radius", "error"}},
+    {"cubesphere", {"radius", "error"}},
+    {"box", {"length", "divisions"}},
+    {"plane", {"length", "divisions"}},
+    {"cone", {"radius", "height", "slices", "stacks"}},
+    {"donut", {"majorRadius", "minorRadius", "sides", "rings"}},
+    {"cylinder", {"radius", "height", "slices"}},
+    {"patch", {"file", "tessellation"}},
+    {"adaptivepatch", {"file", "error"}},
+};
+
+// Parameters that count divisions, which must be whole numbers
+static const std::set<std::string> COUNTS = {"slices", "stacks", "divisions",
+                                             "sides", "rings", "tessellation"};
+
+// Largest count accepted. A figure has about the square of its counts in
+// vertices, which must fit the 32-bit indices of a mesh
+static const int MAX_COUNT = 1 << 15;
+
+/**
+ * Parses the whole value as a finite number, allowing a leading '+' as the
+ * scene parser does
+ */
+static bool parseNumber(const std::string& text, float& value) {
+  const char* first = text.data();
+  const char* end = first + text.size();
+  if (first != end && *first == '+') {
+    first++;
+  }
+  auto [last, status] = std::from_chars(first, end, value);
+  return first != end && status == std::errc() && last == end &&
+         std::isfinite(value);
+}
+
+const std::vector<std::string>* shapeParameters(const std::string& shape) {
+  auto parameters = PARAMETERS.find(shape);
+  return parameters == PARAMETERS.end() ? nullptr : &parameters->second;
+}
+
+bool buildShape(const std::string& shape,
+                const std::vector<std::string>& values, MeshSink& mesh) {
+  const std::vector<std::string>* parameters = shapeParameters(shape);
+  if (!parameters) {
+    std::cerr << "Unknown figure: " << shape << std::endl;
+    return false;
+  }
+  if (values.size() != parameters->size()) {
+    std::cerr << shape << " takes " << parameters->size() << " parameters"
+              << std::endl;
+    return false;
+  }
+
+  // Every parameter is a number except the file of a patch
+  bool patch = shape == "patch" || shape == "adaptivepatch";
+  size_t first = patch ? 1 : 0;
+  std::vector<float> numbers;
+  for (size_t i = first; i < values.size(); i++) {
+    const std::string& name = (*parameters)[i];
+    float number;
+    bool count = COUNTS.count(name) > 0;
+    if (!parseNumber(values[i], number) || !(number > 0) ||
+        (count && (number != std::floor(number) || number > MAX_COUNT))) {
+      std::cerr << "Invalid " << name << " of " << shape << std::endl;
+      return false;
+    }
+    numbers.push_back(number);
+  }
+  auto count = [&](size_t i) { return static_cast<int>(numbers[i]); };
+
+  if (shape == "sphere") {
+    generateSpherePoints(numbers[0], count(1), count(2), mesh);
+  } else if (shape == "icosphere") {
+    int subdivisions = icosphereSubdivisions(numbers[0], numbers[1]);
+    generateIcosphere(numbers[0], subdivisions, mesh);
+  } else if (shape == "cubesphere") {
+    int subdivisions = cubeSphereSubdivisions(numbers[0], numbers[1]);
+    generateCubeSphere(numbers[0], subdivisions, mesh);
+  } else if (shape == "box") {
+    cubeAllPoints(numbers[0], count(1), mesh);
+  } else if (shape == "plane") {
+    generatePlaneData(numbers[0], count(1), mesh);
+  } else if (shape == "cone") {
+    coneTriangles(numbers[0], numbers[1], count(2), count(3), mesh);
+  } else if (shape == "donut") {
+    donutAllPoints(numbers[0], numbers[1], count(2), count(3), mesh);
+  } else if (shape == "cylinder") {
+    calculateCylinder(numbers[0], numbers[1], count(2), mesh);
+  } else {
+    std::vector<PatchPoints> patches;
+    if (!readPatchFile(values[0].c_str(), patches)) {
+      return false;
+    }
+    if (shape == "patch") {
+      tessellatePatches(patches, count(0), mesh);
+    } else {
+      tessellatePatchesAdaptive(patches, numbers[0], mesh);
+    }
+  }
+  return true;
+}
@@ -0,0 +1,77 @@
+#include "shapes/cone.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "utils.hpp"
+
+void coneTriangles(const float baseRadius, const float coneHeight,
+                   const size_t numSlices, const size_t numStacks,
+                   MeshSink& cone) {
+  float anglePerSlice = (float)(2 * M_PI) / numSlices;
+  float heightPerStack = (float)coneHeight / numStacks;
+  float radiusDecrement = (float)baseRadius / numStacks;
+
+  // Base: a fan around the center
+  unsigned int center =
+      cone.addVertex(Point(0, 0, 0), Point(0, -1, 0), Point2D(0.5, 0.5));
+  for (size_t slice = 0; slice < numSlices; slice++) {
+    float angle = slice * anglePerSlice;
+    cone.addVertex(Point(baseRadius * std::sin(angle), 0,
+                         baseRadius * std::cos(angle)),
+                   Point(0, -1, 0),
+                   Point2D(0.5 + 0.5 * sin(angle), 0.5 + 0.5 * cos(angle)));
+  }
+  for (size_t slice = 0; slice < numSlices; slice++) {
+    cone.addTriangle(center + 1 + slice, center,
+                     center + 1 + (slice + 1) % numSlices);
+  }
+
+  // Side: one ring of vertices per stack, from the base up. The normals
+  // are the same along the slant, and the last vertex of a ring repeats
+  // the first with a texture coordinate of 1
+  unsigned int firstRing = static_cast<unsigned int>(cone.vertexCount());
+  const size_t columns = numSlices + 1;
+  for (size_t stackIdx = 0; stackIdx < numStacks; stackIdx++) {
+    float y = stackIdx * heightPerStack;
+    float radius = baseRadius - (stackIdx * radiusDecrement);
+
+    for (size_t slice = 0; slice <= numSlices; slice++) {
+      float angle = slice * anglePerSlice;
+      Point normal(sin(angle), (float)baseRadius / coneHeight, cos(angle));
+      cone.addVertex(Point(radius * sin(angle), y, radius * cos(angle)),
+                     normal.normalize(),
+                     Point2D(angle / (2 * M_PI), y / coneHeight));
+    }
+  }
+
+  for (size_t stackIdx = 0; stackIdx + 1 < numStacks; stackIdx++) {
+    for (size_t slice = 0; slice < numSlices; slice++) {
+      unsigned int lower1 = firstRing + stackIdx * columns + slice;
+      unsigned int lower2 = lower1 + 1;
+      unsigned int upper1 = lower1 + columns, upper2 = upper1 + 1;
+
+      cone.addTriangle(upper1, lower1, lower2);
+      cone.addTriangle(upper1, lower2, upper2);
+    }
+  }
+
+  // Top stack: one triangle per slice up to the apex, which takes the
+  // horizontal normal halfway between the slice's edges
+  unsigned int topRing = firstRing + (numStacks - 1) * columns;
+  float apexY = numStacks * heightPerStack;
+  float apexRadius = baseRadius - (numStacks * radiusDecrement);
+  for (size_t slice = 0; slice < numSlices; slice++) {
+    float angle = slice * anglePerSlice;
+    Point avgTopNormal((sin(angle) + sin(angle + anglePerSlice)) / 2.0f, 0,
+                       (cos(angle) + cos(angle + anglePerSlice)) / 2.0f);
+    unsigned int apex = cone.addVertex(
+        Point(apexRadius * sin(angle), apexY, apexRadius * cos(angle)),
+        avgTopNormal.normalize(),
+        Point2D(angle / (2 * M_PI), apexY / coneHeight));
+
+    cone.addTriangle(apex, topRing + slice, topRing + slice + 1);
+  }
+}
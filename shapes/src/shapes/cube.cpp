@@ -0,0 +1,98 @@
+#include "shapes/cube.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "utils.hpp"
+
+/**
+ * @brief Adds one face of the cube as a grid of shared vertices
+ *
+ * @param faceVertex Position and texture coordinates of the grid vertex
+ * (a, b), for a and b from 0 to divisions
+ * @param reversed Winds the triangles the other way, for the faces whose
+ * (a, b) axes are not counter-clockwise seen from outside
+ */
+template <typename FaceVertex>
+static void addFace(MeshSink& cube, int divisions, const Point& normal,
+                    bool reversed, const FaceVertex& faceVertex) {
+  unsigned int first = static_cast<unsigned int>(cube.vertexCount());
+  for (int a = 0; a <= divisions; ++a) {
+    for (int b = 0; b <= divisions; ++b) {
+      auto [point, texture] = faceVertex(a, b);
+      cube.addVertex(point, normal, texture);
+    }
+  }
+
+  const int columns = divisions + 1;
+  for (int a = 0; a < divisions; ++a) {
+    for (int b = 0; b < divisions; ++b) {
+      unsigned int v00 = first + a * columns + b, v01 = v00 + 1;
+      unsigned int v10 = v00 + columns, v11 = v10 + 1;
+      if (reversed) {
+        cube.addTriangle(v00, v01, v10);
+        cube.addTriangle(v01, v11, v10);
+      } else {
+        cube.addTriangle(v00, v10, v01);
+        cube.addTriangle(v01, v10, v11);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Generates a cube divided into a grid of triangles on each face
+ *
+ * This function creates a cube centered at the origin with the specified length
+ * and divides each face into the given number of segments.
+ *
+ * @param length The side length of the cube
+ * @param divisions Number of divisions per face side
+ * @param cube Receives six grids of (divisions + 1)² shared vertices, one
+ * per face
+ */
+void cubeAllPoints(float length, int divisions, MeshSink& cube) {
+  float cubeSide = length / 2.0f;       // Half length for centering at origin
+  float gridSize = length / divisions;  // Size of each grid cell
+
+  // Grid line positions, and the same normalized to [0,1]
+  auto pos = [&](int i) { return -cubeSide + i * gridSize; };
+  auto tex = [&](int i) { return (pos(i) + cubeSide) / length; };
+  // Grid-based mapping of the left face
+  auto gridTex = [&](int i) { return static_cast<float>(i) / divisions; };
+
+  // ----- Front Face (Z+) -----
+  addFace(cube, divisions, Point(0.0f, 0.0f, 1.0f), false, [&](int a, int b) {
+    return std::pair(Point(pos(a), pos(b), cubeSide), Point2D(tex(a), tex(b)));
+  });
+
+  // ----- Back Face (Z-) -----
+  addFace(cube, divisions, Point(0.0f, 0.0f, -1.0f), true, [&](int a, int b) {
+    return std::pair(Point(pos(a), pos(b), -cubeSide),
+                     Point2D(tex(a), tex(b)));
+  });
+
+  // ----- Left Face (X-) -----
+  addFace(cube, divisions, Point(-1.0f, 0.0f, 0.0f), true, [&](int a, int b) {
+    return std::pair(Point(-cubeSide, pos(a), pos(b)),
+                     Point2D(gridTex(a), gridTex(b)));
+  });
+
+  // ----- Right Face (X+) -----
+  addFace(cube, divisions, Point(1.0f, 0.0f, 0.0f), false, [&](int a, int b) {
+    return std::pair(Point(cubeSide, pos(a), pos(b)), Point2D(tex(b), tex(a)));
+  });
+
+  // ----- Top Face (Y+) -----
+  addFace(cube, divisions, Point(0.0f, 1.0f, 0.0f), true, [&](int a, int b) {
+    return std::pair(Point(pos(a), cubeSide, pos(b)), Point2D(tex(a), tex(b)));
+  });
+
+  // ----- Bottom Face (Y-) -----
+  addFace(cube, divisions, Point(0.0f, -1.0f, 0.0f), false, [&](int a, int b) {
+    return std::pair(Point(pos(a), -cubeSide, pos(b)),
+                     Point2D(tex(a), tex(b)));
+  });
+}
@@ -0,0 +1,63 @@
+#include "shapes/cylinder.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "utils.hpp"
+
+void calculateCylinder(const float radius, const float height,
+                       const int slices, MeshSink& cylinder) {
+  float angleStep = 2.0f * M_PI / slices;
+
+  // Top circle: a fan around the center
+  Point normal = {0.0f, 1.0f, 0.0f};
+  unsigned int topCenter = cylinder.addVertex({0.0f, height / 2.0f, 0.0f},
+                                              normal, {0.4375f, 0.1875f});
+  for (int i = 0; i < slices; ++i) {
+    cylinder.addVertex({radius * std::sin(i * angleStep), height / 2.0f,
+                        radius * std::cos(i * angleStep)},
+                       normal,
+                       {0.4375f + 0.1875f * std::sin(i * angleStep),
+                        0.1875f + 0.1875f * std::cos(i * angleStep)});
+  }
+
+  // Bottom circle
+  normal = {0.0f, -1.0f, 0.0f};
+  unsigned int bottomCenter = cylinder.addVertex(
+      {0.0f, -height / 2.0f, 0.0f}, normal, {0.8125f, 0.1875f});
+  for (int i = 0; i < slices; ++i) {
+    cylinder.addVertex({radius * std::sin(i * angleStep), -height / 2.0f,
+                        radius * std::cos(i * angleStep)},
+                       normal,
+                       {0.8125f + 0.1875f * std::sin(i * angleStep),
+                        0.1875f + 0.1875f * std::cos(i * angleStep)});
+  }
+
+  // Side wall: a top and a bottom vertex per slice edge, the last edge
+  // repeating the first with a texture coordinate of 1
+  unsigned int side = static_cast<unsigned int>(cylinder.vertexCount());
+  for (int i = 0; i <= slices; ++i) {
+    normal = {std::sin(i * angleStep), 0.0f, std::cos(i * angleStep)};
+    cylinder.addVertex({radius * std::sin(i * angleStep), height / 2.0f,
+                        radius * std::cos(i * angleStep)},
+                       normal, {i / static_cast<float>(slices), 1.0f});
+    cylinder.addVertex({radius * std::sin(i * angleStep), -height / 2.0f,
+                        radius * std::cos(i * angleStep)},
+                       normal, {i / static_cast<float>(slices), 0.375f});
+  }
+
+  for (int i = 0; i < slices; ++i) {
+    unsigned int next = (i + 1) % slices;
+    cylinder.addTriangle(topCenter, topCenter + 1 + i, topCenter + 1 + next);
+
+    unsigned int top = side + 2 * i, bottom = top + 1;
+    unsigned int nextTop = top + 2, nextBottom = bottom + 2;
+    cylinder.addTriangle(nextTop, top, bottom);
+    cylinder.addTriangle(nextBottom, nextTop, bottom);
+
+    cylinder.addTriangle(bottomCenter, bottomCenter + 1 + next,
+                         bottomCenter + 1 + i);
+  }
+}
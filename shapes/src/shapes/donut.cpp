@@ -0,0 +1,72 @@
+#include "shapes/donut.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "utils.hpp"
+
+/**
+ * @brief Generates a torus/donut shape divided into triangles
+ *
+ * This function creates a torus (donut shape) with the specified parameters.
+ * The torus is defined by a major radius (distance from center of tube to
+ * center of torus) and a minor radius (the radius of the tube itself).
+ *
+ * @param majorRadius Distance from center of torus to center of tube
+ * @param minorRadius Radius of the tube itself
+ * @param sides Number of divisions around the tube (minor circle)
+ * @param rings Number of divisions around the torus (major circle)
+ * @param torus Receives a grid of (rings + 1) x (sides + 1) shared vertices,
+ * with two triangles per quad
+ */
+void donutAllPoints(float majorRadius, float minorRadius, int sides, int rings,
+                    MeshSink& torus) {
+  const unsigned int first = torus.vertexCount();
+  const int columns = sides + 1;
+
+  // Vertices, ring by ring around the torus (major circle). The last ring
+  // and side repeat the first ones with texture coordinates of 1
+  for (int ringIdx = 0; ringIdx <= rings; ++ringIdx) {
+    float outerAngle = static_cast<float>(ringIdx) * 2.0f *
+                       static_cast<float>(M_PI) / static_cast<float>(rings);
+
+    // Around the tube (minor circle)
+    for (int tubeIdx = 0; tubeIdx <= sides; ++tubeIdx) {
+      float innerAngle = static_cast<float>(tubeIdx) * 2.0f *
+                         static_cast<float>(M_PI) / static_cast<float>(sides);
+
+      float vx = (majorRadius + minorRadius * std::cos(innerAngle)) *
+                 std::cos(outerAngle);
+      float vy = minorRadius * std::sin(innerAngle);
+      float vz = (majorRadius + minorRadius * std::cos(innerAngle)) *
+                 std::sin(outerAngle);
+
+      // Normal pointing outward from the torus tube: the vertex minus the
+      // ring center
+      Point normal(vx - majorRadius * std::cos(outerAngle), vy,
+                   vz - majorRadius * std::sin(outerAngle));
+
+      // Texture coordinates (UV mapping)
+      Point2D texture(
+          static_cast<float>(tubeIdx) / static_cast<float>(sides),
+          static_cast<float>(ringIdx) / static_cast<float>(rings));
+
+      torus.addVertex(Point(vx, vy, vz), normal, texture);
+    }
+  }
+
+  for (int ringIdx = 0; ringIdx < rings; ++ringIdx) {
+    for (int tubeIdx = 0; tubeIdx < sides; ++tubeIdx) {
+      // The four vertices of the current quad: 1 is (ringIdx, tubeIdx),
+      // 2 is (ringIdx, tubeIdx+1), 3 is (ringIdx+1, tubeIdx) and 4 is
+      // (ringIdx+1, tubeIdx+1)
+      unsigned int v1 = first + ringIdx * columns + tubeIdx, v2 = v1 + 1;
+      unsigned int v3 = v1 + columns, v4 = v3 + 1;
+
+      torus.addTriangle(v1, v2, v4);
+      torus.addTriangle(v1, v4, v3);
+    }
+  }
+}
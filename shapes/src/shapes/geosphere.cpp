@@ -0,0 +1,406 @@
+#include "shapes/geosphere.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Finest subdivision used when the error asked for is smaller still
+static const int MAX_SUBDIVISIONS = 2048;
+
+/**
+ * Vector in double precision, so that the error of fine tessellations
+ * isn't lost to rounding
+ */
+struct Direction {
+  double x, y, z;
+
+  Direction operator+(const Direction& other) const {
+    return {x + other.x, y + other.y, z + other.z};
+  }
+  Direction operator-(const Direction& other) const {
+    return {x - other.x, y - other.y, z - other.z};
+  }
+  Direction operator*(double scale) const {
+    return {x * scale, y * scale, z * scale};
+  }
+  double dot(const Direction& other) const {
+    return x * other.x + y * other.y + z * other.z;
+  }
+  Direction cross(const Direction& other) const {
+    return {y * other.z - z * other.y, z * other.x - x * other.z,
+            x * other.y - y * other.x};
+  }
+  double length() const { return std::sqrt(dot(*this)); }
+  Direction normalized() const { return *this * (1 / length()); }
+};
+
+/**
+ * Vertex of a subdivided face, with a key that is the same on every face
+ * the vertex is on
+ */
+struct GridPoint {
+  uint64_t key;
+  Direction direction;
+};
+
+/**
+ * Distance from the center of the sphere to the closest point of triangle
+ * abc, by the Voronoi region of the triangle the center falls in
+ */
+static double distanceToTriangle(const Direction& a, const Direction& b,
+                                 const Direction& c) {
+  Direction ab = b - a, ac = c - a;
+  double d1 = -ab.dot(a), d2 = -ac.dot(a);
+  if (d1 <= 0 && d2 <= 0) {
+    return a.length();
+  }
+  double d3 = -ab.dot(b), d4 = -ac.dot(b);
+  if (d3 >= 0 && d4 <= d3) {
+    return b.length();
+  }
+  double vc = d1 * d4 - d3 * d2;
+  if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+    return (a + ab * (d1 / (d1 - d3))).length();
+  }
+  double d5 = -ab.dot(c), d6 = -ac.dot(c);
+  if (d6 >= 0 && d5 <= d6) {
+    return c.length();
+  }
+  double vb = d5 * d2 - d1 * d6;
+  if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+    return (a + ac * (d2 / (d2 - d6))).length();
+  }
+  double va = d3 * d6 - d5 * d4;
+  if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0) {
+    double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+    return (b + (c - b) * w).length();
+  }
+  double scale = 1 / (va + vb + vc);
+  return (a + ab * (vb * scale) + ac * (vc * scale)).length();
+}
+
+/**
+ * Corners of a unit icosahedron and its faces, counter-clockwise seen from
+ * outside
+ */
+struct Icosahedron {
+  std::vector<Direction> corners;
+  std::vector<std::array<int, 3>> faces;
+
+  Icosahedron() {
+    const double phi = (1 + std::sqrt(5.0)) / 2;
+    for (double a : {-1.0, 1.0}) {
+      for (double b : {-phi, phi}) {
+        corners.push_back(Direction{0, a, b});
+        corners.push_back(Direction{a, b, 0});
+        corners.push_back(Direction{b, 0, a});
+      }
+    }
+    // Corners 2 apart are joined by an edge, and three of them by a face
+    auto edge = [&](int i, int j) {
+      return std::abs((corners[i] - corners[j]).length() - 2) < 1e-9;
+    };
+    for (int i = 0; i < 12; i++) {
+      for (int j = i + 1; j < 12; j++) {
+        for (int k = j + 1; k < 12; k++) {
+          if (!edge(i, j) || !edge(j, k) || !edge(i, k)) {
+            continue;
+          }
+          Direction normal =
+              (corners[j] - corners[i]).cross(corners[k] - corners[i]);
+          if (normal.dot(corners[i]) > 0) {
+            faces.push_back({i, j, k});
+          } else {
+            faces.push_back({i, k, j});
+          }
+        }
+      }
+    }
+    for (Direction& corner : corners) {
+      corner = corner.normalized();
+    }
+  }
+};
+
+static const Icosahedron ICOSAHEDRON;
+
+/**
+ * Calls visit(a, b, c) for every triangle of an icosahedron face whose
+ * edges are split into n parts
+ */
+template <typename Visit>
+static void icosphereFace(int face, int n, const Visit& visit) {
+  const std::array<int, 3>& corners = ICOSAHEDRON.faces[face];
+
+  // The point with weights n - i - j, i and j on the face's corners. It is
+  // computed from the corners in index order, so that the faces around an
+  // edge agree on it to the bit
+  auto point = [&](int i, int j) {
+    std::array<std::pair<int, int>, 3> weights = {
+        std::pair(corners[0], n - i - j), std::pair(corners[1], i),
+        std::pair(corners[2], j)};
+    std::sort(weights.begin(), weights.end());
+    GridPoint point{0, Direction{0, 0, 0}};
+    for (const auto& [corner, weight] : weights) {
+      if (weight > 0) {
+        point.key = point.key << 16 | corner << 12 | weight;
+        point.direction =
+            point.direction + ICOSAHEDRON.corners[corner] * weight;
+      }
+    }
+    point.direction = point.direction.normalized();
+    return point;
+  };
+
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n - i; j++) {
+      visit(point(i, j), point(i + 1, j), point(i, j + 1));
+      if (i + j < n - 1) {
+        visit(point(i + 1, j), point(i + 1, j + 1), point(i, j + 1));
+      }
+    }
+  }
+}
+
+/**
+ * Calls visit(a, b, c) for every triangle of a cube face split into an
+ * n x n grid. Face 0 to 5 is +x, +y, +z, -x, -y, -z.
+ */
+template <typename Visit>
+static void cubeSphereFace(int face, int n, const Visit& visit) {
+  int axis = face % 3;
+  int sign = face < 3 ? 1 : -1;
+
+  // The grid lines are equally spaced in angle. A vertex is keyed by its
+  // grid coordinates on the whole cube, from 0 to n on each axis, which the
+  // faces around it share
+  std::vector<double> tangents(n + 1);
+  for (int i = 0; i <= n; i++) {
+    tangents[i] = std::tan((2.0 * i - n) / n * M_PI / 4);
+  }
+  tangents[0] = -1;
+  tangents[n] = 1;
+
+  auto point = [&](int i, int j) {
+    std::array<int, 3> grid;
+    std::array<double, 3> tangent;
+    grid[axis] = sign > 0 ? n : 0;
+    grid[(axis + 1) % 3] = i;
+    grid[(axis + 2) % 3] = j;
+    for (int k = 0; k < 3; k++) {
+      tangent[k] = tangents[grid[k]];
+    }
+    uint64_t key = static_cast<uint64_t>(grid[0]) << 32 |
+                   static_cast<uint64_t>(grid[1]) << 16 | grid[2];
+    Direction direction{tangent[0], tangent[1], tangent[2]};
+    return GridPoint{key, direction.normalized()};
+  };
+
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      GridPoint p00 = point(i, j), p10 = point(i + 1, j);
+      GridPoint p01 = point(i, j + 1), p11 = point(i + 1, j + 1);
+      // Cells near the cube's corners are rhombi, split along their shorter
+      // diagonal to keep the triangles compact
+      if ((p11.direction - p00.direction).length() <=
+          (p01.direction - p10.direction).length()) {
+        visit(p00, p10, p11);
+        visit(p00, p11, p01);
+      } else {
+        visit(p00, p10, p01);
+        visit(p10, p11, p01);
+      }
+    }
+  }
+}
+
+/**
+ * Chordal error of a unit sphere tessellated face by face. All faces are
+ * alike, so one is enough.
+ */
+template <typename Face>
+static double chordalError(int n, const Face& face) {
+  double error = 0;
+  face(0, n, [&](const GridPoint& a, const GridPoint& b, const GridPoint& c) {
+    error = std::max(
+        error, 1 - distanceToTriangle(a.direction, b.direction, c.direction));
+  });
+  return error;
+}
+
+static double icosphereError(int n) {
+  return chordalError(n, [](int face, int n, const auto& visit) {
+    icosphereFace(face, n, visit);
+  });
+}
+
+static double cubeSphereError(int n) {
+  return chordalError(n, [](int face, int n, const auto& visit) {
+    cubeSphereFace(face, n, visit);
+  });
+}
+
+/**
+ * Smallest n whose error is at most maxError, given that the error only
+ * shrinks as n grows
+ *
+ * @return 0 if the radius or the error are not positive
+ */
+template <typename Error>
+static int subdivisionsFor(float radius, float maxError, const Error& error) {
+  if (!(radius > 0) || !(maxError > 0)) {
+    std::cerr << "The radius and the error must be positive" << std::endl;
+    return 0;
+  }
+  double unitError = maxError / radius;
+
+  int high = 1;
+  while (error(high) > unitError) {
+    if (high == MAX_SUBDIVISIONS) {
+      std::cerr << "An error of " << maxError << " needs more than "
+                << MAX_SUBDIVISIONS << " subdivisions, using "
+                << MAX_SUBDIVISIONS << std::endl;
+      return MAX_SUBDIVISIONS;
+    }
+    high = std::min(high * 2, MAX_SUBDIVISIONS);
+  }
+  int low = high / 2;
+  while (high - low > 1) {
+    int middle = (low + high) / 2;
+    if (error(middle) > unitError) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+  return high;
+}
+
+int icosphereSubdivisions(float radius, float maxError) {
+  return subdivisionsFor(radius, maxError, icosphereError);
+}
+
+int cubeSphereSubdivisions(float radius, float maxError) {
+  return subdivisionsFor(radius, maxError, cubeSphereError);
+}
+
+/**
+ * Unit vectors shared by key, and the triangles over them, before they get
+ * texture coordinates
+ */
+struct SphereMesh {
+  std::vector<Direction> directions;
+  std::vector<std::array<unsigned int, 3>> triangles;
+  std::unordered_map<uint64_t, unsigned int> indices;
+
+  unsigned int vertex(const GridPoint& point) {
+    auto [index, added] = indices.emplace(point.key, directions.size());
+    if (added) {
+      directions.push_back(point.direction);
+    }
+    return index->second;
+  }
+
+  // Wound counter-clockwise seen from outside
+  void addTriangle(const GridPoint& a, const GridPoint& b,
+                   const GridPoint& c) {
+    Direction normal =
+        (b.direction - a.direction).cross(c.direction - a.direction);
+    if (normal.dot(a.direction + b.direction + c.direction) > 0) {
+      triangles.push_back({vertex(a), vertex(b), vertex(c)});
+    } else {
+      triangles.push_back({vertex(a), vertex(c), vertex(b)});
+    }
+  }
+};
+
+/**
+ * Adds the sphere to the sink with the texture mapping of the UV sphere.
+ * A triangle across the seam gets copies of its vertices at u + 1, and a
+ * vertex at a pole a copy per triangle, at the u of the triangle's others.
+ */
+static void addSphere(const SphereMesh& mesh, float radius,
+                      MeshSink& sphere) {
+  const unsigned int NONE = ~0u;
+  size_t count = mesh.directions.size();
+  std::vector<Point2D> textures(count);
+  std::vector<bool> poles(count);
+  for (size_t i = 0; i < count; i++) {
+    const Direction& d = mesh.directions[i];
+    double u = std::atan2(d.x, d.z) / (2 * M_PI);
+    double v = std::acos(std::clamp(d.y, -1.0, 1.0)) / M_PI;
+    textures[i] = Point2D(u < 0 ? u + 1 : u, v);
+    poles[i] = d.x * d.x + d.z * d.z < 1e-12;
+  }
+
+  // Index in the sink of each vertex, then of its copy past the seam
+  std::vector<unsigned int> added(2 * count, NONE);
+  auto addVertex = [&](unsigned int vertex, float u) {
+    const Direction& d = mesh.directions[vertex];
+    Point normal(d.x, d.y, d.z);
+    return sphere.addVertex(
+        Point(radius * normal.x, radius * normal.y, radius * normal.z), normal,
+        Point2D(u, textures[vertex].y));
+  };
+
+  for (const std::array<unsigned int, 3>& triangle : mesh.triangles) {
+    float minU = 1, maxU = 0;
+    for (unsigned int vertex : triangle) {
+      if (!poles[vertex]) {
+        minU = std::min(minU, textures[vertex].x);
+        maxU = std::max(maxU, textures[vertex].x);
+      }
+    }
+    bool acrossSeam = maxU - minU > 0.5f;
+
+    std::array<unsigned int, 3> indices;
+    float sumU = 0;
+    int sides = 0;
+    for (int k = 0; k < 3; k++) {
+      unsigned int vertex = triangle[k];
+      if (poles[vertex]) {
+        continue;
+      }
+      bool wrapped = acrossSeam && textures[vertex].x < 0.5f;
+      float u = textures[vertex].x + (wrapped ? 1 : 0);
+      unsigned int& index = added[2 * vertex + wrapped];
+      if (index == NONE) {
+        index = addVertex(vertex, u);
+      }
+      indices[k] = index;
+      sumU += u;
+      sides++;
+    }
+    for (int k = 0; k < 3; k++) {
+      if (poles[triangle[k]]) {
+        indices[k] = addVertex(triangle[k], sides ? sumU / sides : 0);
+      }
+    }
+    sphere.addTriangle(indices[0], indices[1], indices[2]);
+  }
+}
+
+void generateIcosphere(float radius, int subdivisions, MeshSink& sphere) {
+  SphereMesh mesh;
+  for (size_t face = 0; face < ICOSAHEDRON.faces.size(); face++) {
+    icosphereFace(face, subdivisions,
+                  [&](const GridPoint& a, const GridPoint& b,
+                      const GridPoint& c) { mesh.addTriangle(a, b, c); });
+  }
+  addSphere(mesh, radius, sphere);
+}
+
+void generateCubeSphere(float radius, int subdivisions, MeshSink& sphere) {
+  SphereMesh mesh;
+  for (int face = 0; face < 6; face++) {
+    cubeSphereFace(face, subdivisions,
+                   [&](const GridPoint& a, const GridPoint& b,
+                       const GridPoint& c) { mesh.addTriangle(a, b, c); });
+  }
+  addSphere(mesh, radius, sphere);
+}
@@ -0,0 +1,704 @@
+#include "shapes/patches.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <tuple>
+#include <vector>
+
+#include "jobs.hpp"
+#include "utils.hpp"
+
+Point bezierPatchDU(const PatchPoints& controlPoints, float u, float v);
+Point bezierPatchDV(const PatchPoints& controlPoints, float u, float v);
+
+// Grid rows of a patch tessellated together by one job
+static const int BAND_ROWS = 16;
+
+// Vertices tessellated at a time when passing patches to a MeshSink
+static const size_t BATCH_VERTICES = 1 << 20;
+
+// Most segments along either direction of a patch in adaptive mode
+static const int MAX_ADAPTIVE_SEGMENTS = 1024;
+
+// Points along each direction of a patch where its curvature is measured
+static const int CURVATURE_SAMPLES = 9;
+
+bool readPatchFile(const char* inputFile, std::vector<PatchPoints>& patches) {
+  // printing actual directory
+  std::cout << "Current working directory: " << std::filesystem::current_path()
+            << std::endl;
+  std::cout << "Input file: " << inputFile << std::endl;
+
+  // Open and read the input file
+  std::ifstream inputStream(inputFile);
+  if (!inputStream.is_open()) {
+    std::cerr << "Error opening input file\n";
+    return false;
+  }
+
+  // Read number of patches
+  size_t patchCount;
+  inputStream >> patchCount;
+
+  // Read patch indices (16 control points per patch)
+  std::vector<std::array<size_t, 16>> indices(patchCount);
+  for (auto& patch : indices) {
+    for (auto& index : patch) {
+      inputStream >> index;
+      inputStream.ignore();
+    }
+  }
+
+  // Read all control points
+  size_t controlPointCount;
+  inputStream >> controlPointCount;
+  std::vector<Point> controlPoints;
+  controlPoints.reserve(controlPointCount);
+
+  for (size_t i = 0; i < controlPointCount; ++i) {
+    float x, y, z;
+    char separator;
+    inputStream >> x >> separator >> y >> separator >> z;
+    controlPoints.emplace_back(x, y, z);
+  }
+  if (!inputStream) {
+    std::cerr << "Error reading patch file " << inputFile << std::endl;
+    return false;
+  }
+
+  // Control points of every patch, gathered once for all threads
+  patches.resize(patchCount);
+  for (size_t patch = 0; patch < patchCount; ++patch) {
+    for (size_t i = 0; i < 16; ++i) {
+      if (indices[patch][i] >= controlPointCount) {
+        std::cerr << "Patch " << patch << " uses control point "
+                  << indices[patch][i] << " of " << controlPointCount
+                  << std::endl;
+        return false;
+      }
+      patches[patch][i] = controlPoints[indices[patch][i]];
+    }
+  }
+  return true;
+}
+
+IndexedMesh patchTriangles(const char* inputFile, const int tessellationLevel) {
+  std::vector<PatchPoints> patches;
+  if (!readPatchFile(inputFile, patches)) {
+    return IndexedMesh();
+  }
+  return tessellatePatches(patches, tessellationLevel);
+}
+
+/**
+ * Unit normal at (u, v) from the surface derivatives. Where they are
+ * parallel or vanish, as on the collapsed edges of the teapot's lid and
+ * bottom, the normal is taken a little inside the patch instead.
+ */
+static Point surfaceNormal(const PatchPoints& controlPoints, float u, float v,
+                           Point du, Point dv) {
+  Point normal = dv.cross(du);
+  float length = std::sqrt(normal.x * normal.x + normal.y * normal.y +
+                           normal.z * normal.z);
+  float scale = std::sqrt((du.x * du.x + du.y * du.y + du.z * du.z) *
+                          (dv.x * dv.x + dv.y * dv.y + dv.z * dv.z));
+  if (length == 0.0f || length <= 1e-6f * scale) {
+    u += u < 0.5f ? 1e-3f : -1e-3f;
+    v += v < 0.5f ? 1e-3f : -1e-3f;
+    normal = bezierPatchDV(controlPoints, u, v)
+                 .cross(bezierPatchDU(controlPoints, u, v));
+    length = std::sqrt(normal.x * normal.x + normal.y * normal.y +
+                       normal.z * normal.z);
+  }
+  return length > 0.0f ? normal.normalize() : normal;
+}
+
+/**
+ * Bernstein polynomials and their derivatives at t = k / level, for
+ * k = 0 … level, one array per polynomial
+ */
+struct BernsteinTable {
+  std::vector<float> basis[4], derivative[4];
+
+  explicit BernsteinTable(int level) {
+    for (int i = 0; i < 4; ++i) {
+      basis[i].resize(level + 1);
+      derivative[i].resize(level + 1);
+      for (int k = 0; k <= level; ++k) {
+        float t = static_cast<float>(k) / level;
+        basis[i][k] = bernstein(i, t);
+        derivative[i][k] = bernsteinDerivative(i, t);
+      }
+    }
+  }
+};
+
+/**
+ * One row of the grid of a patch, at u = i / level, laid out as separate
+ * x, y and z arrays so the loops over v vectorize
+ */
+struct GridRow {
+  std::vector<float> x, y, z;     // Position
+  std::vector<float> ux, uy, uz;  // ∂/∂u
+  std::vector<float> vx, vy, vz;  // ∂/∂v
+
+  explicit GridRow(int level)
+      : x(level + 1), y(level + 1), z(level + 1), ux(level + 1),
+        uy(level + 1), uz(level + 1), vx(level + 1), vy(level + 1),
+        vz(level + 1) {}
+};
+
+/**
+ * Evaluates row i of the grid. With B the table of basis values and G the
+ * control points, the positions of the row are Bu(i) · G · Bvᵀ: the u basis
+ * first folds G into four points a[j], then every column is a combination
+ * of them. The derivatives reuse the same products with one side
+ * differentiated.
+ */
+static void evaluateRow(const PatchPoints& G, const BernsteinTable& table,
+                        int level, int i, GridRow& row) {
+  float a[3][4], da[3][4];
+  for (int j = 0; j < 4; ++j) {
+    a[0][j] = a[1][j] = a[2][j] = 0.0f;
+    da[0][j] = da[1][j] = da[2][j] = 0.0f;
+    for (int m = 0; m < 4; ++m) {
+      const Point& p = G[m * 4 + j];
+      float b = table.basis[m][i], db = table.derivative[m][i];
+      a[0][j] += b * p.x;
+      a[1][j] += b * p.y;
+      a[2][j] += b * p.z;
+      da[0][j] += db * p.x;
+      da[1][j] += db * p.y;
+      da[2][j] += db * p.z;
+    }
+  }
+
+  const float* B[4] = {table.basis[0].data(), table.basis[1].data(),
+                       table.basis[2].data(), table.basis[3].data()};
+  const float* D[4] = {table.derivative[0].data(), table.derivative[1].data(),
+                       table.derivative[2].data(), table.derivative[3].data()};
+  float* position[3] = {row.x.data(), row.y.data(), row.z.data()};
+  float* du[3] = {row.ux.data(), row.uy.data(), row.uz.data()};
+  float* dv[3] = {row.vx.data(), row.vy.data(), row.vz.data()};
+  for (int c = 0; c < 3; ++c) {
+    for (int k = 0; k <= level; ++k) {
+      position[c][k] = a[c][0] * B[0][k] + a[c][1] * B[1][k] +
+                       a[c][2] * B[2][k] + a[c][3] * B[3][k];
+      du[c][k] = da[c][0] * B[0][k] + da[c][1] * B[1][k] +
+                 da[c][2] * B[2][k] + da[c][3] * B[3][k];
+      dv[c][k] = a[c][0] * D[0][k] + a[c][1] * D[1][k] + a[c][2] * D[2][k] +
+                 a[c][3] * D[3][k];
+    }
+  }
+}
+
+/**
+ * Tessellates patchCount patches from the given one into a new mesh
+ */
+static IndexedMesh tessellateRange(const PatchPoints* patches,
+                                   size_t patchCount, const int level) {
+  IndexedMesh mesh;
+  if (patchCount == 0 || level < 1) {
+    return mesh;
+  }
+  const BernsteinTable table(level);
+
+  // Every patch has a fixed slice of the vertices and indices, so patches
+  // are tessellated in parallel without any locking
+  const size_t columns = level + 1;
+  const size_t patchVertices = columns * columns;
+  const size_t patchIndices = static_cast<size_t>(level) * level * 6;
+  mesh.points.resize(patchCount * patchVertices);
+  mesh.normals.resize(mesh.points.size());
+  mesh.textures.resize(mesh.points.size());
+  mesh.indices.resize(patchCount * patchIndices);
+
+  // A job is a band of grid rows of one patch, with the quads below them
+  const size_t bandsPerPatch = (columns + BAND_ROWS - 1) / BAND_ROWS;
+  runJobs(patchCount * bandsPerPatch, [&](size_t job) {
+    size_t patch = job / bandsPerPatch;
+    const PatchPoints& G = patches[patch];
+    int first = static_cast<int>(job % bandsPerPatch) * BAND_ROWS;
+    int last = std::min(first + BAND_ROWS, level + 1);
+    size_t base = patch * patchVertices;
+
+    GridRow row(level);
+    for (int i = first; i < last; ++i) {
+      evaluateRow(G, table, level, i, row);
+      float u = static_cast<float>(i) / level;
+      for (int k = 0; k <= level; ++k) {
+        float v = static_cast<float>(k) / level;
+        size_t vertex = base + i * columns + k;
+        mesh.points[vertex] = Point(row.x[k], row.y[k], row.z[k]);
+        mesh.normals[vertex] =
+            surfaceNormal(G, u, v, Point(row.ux[k], row.uy[k], row.uz[k]),
+                          Point(row.vx[k], row.vy[k], row.vz[k]));
+        mesh.textures[vertex] = Point2D(u, v);
+      }
+    }
+
+    const size_t rowIndices = static_cast<size_t>(level) * 6;
+    for (int uStep = first; uStep < std::min(last, level); ++uStep) {
+      size_t out = patch * patchIndices + uStep * rowIndices;
+      for (int vStep = 0; vStep < level; ++vStep, out += 6) {
+        // Corners (u1, v1), (u2, v1), (u1, v2) and (u2, v2)
+        unsigned int c1 = base + uStep * columns + vStep;
+        unsigned int c2 = c1 + columns, c3 = c1 + 1, c4 = c2 + 1;
+
+        // Add two triangles (forming a quad)
+        const unsigned int quad[] = {c1, c3, c2, c2, c3, c4};
+        std::copy(quad, quad + 6, mesh.indices.begin() + out);
+      }
+    }
+  });
+
+  return mesh;
+}
+
+IndexedMesh tessellatePatches(const std::vector<PatchPoints>& patches,
+                              const int tessellationLevel) {
+  return tessellateRange(patches.data(), patches.size(), tessellationLevel);
+}
+
+void tessellatePatches(const std::vector<PatchPoints>& patches,
+                       const int tessellationLevel, MeshSink& mesh) {
+  // As many patches at a time as fit in about BATCH_VERTICES vertices
+  size_t columns = static_cast<size_t>(std::max(tessellationLevel, 0)) + 1;
+  size_t batch = std::max<size_t>(1, BATCH_VERTICES / (columns * columns));
+  for (size_t first = 0; first < patches.size(); first += batch) {
+    size_t count = std::min(batch, patches.size() - first);
+    tessellateRange(patches.data() + first, count, tessellationLevel)
+        .copyTo(mesh);
+  }
+}
+
+static float length(const Point& p) {
+  return std::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+}
+
+// |a - 2b + c|, a second difference of control points
+static float secondDifference(const Point& a, const Point& b, const Point& c) {
+  return length(Point(a.x - 2 * b.x + c.x, a.y - 2 * b.y + c.y,
+                      a.z - 2 * b.z + c.z));
+}
+
+// Rounds a number of segments up and into range
+static int segmentCount(float n) {
+  return static_cast<int>(std::clamp(
+      std::ceil(n), 1.0f, static_cast<float>(MAX_ADAPTIVE_SEGMENTS)));
+}
+
+/**
+ * Control points of side s of a patch, by increasing parameter: v = 0, u = 1,
+ * v = 1 and u = 0, which go around it counterclockwise in (u, v)
+ */
+static std::array<Point, 4> sidePoints(const PatchPoints& G, int side) {
+  std::array<Point, 4> points;
+  for (int k = 0; k < 4; ++k) {
+    const int index[] = {k * 4, 12 + k, k * 4 + 3, k};
+    points[k] = G[index[side]];
+  }
+  return points;
+}
+
+/**
+ * Segments of a side, from its own control points only. A cubic whose second
+ * derivative never exceeds M strays at most M / (8 n²) from n equal chords;
+ * the side gets half the error, as the strip along it also bends inwards.
+ */
+static int sideSegments(const std::array<Point, 4>& p, float maxError) {
+  float bound = 6.0f * std::max(secondDifference(p[0], p[1], p[2]),
+                                secondDifference(p[1], p[2], p[3]));
+  return segmentCount(std::sqrt(bound / (4.0f * maxError)));
+}
+
+/**
+ * Point k / segments along a side. The curve is evaluated from whichever
+ * end compares lower, so the two patches sharing a side, which may run it
+ * in opposite directions, compute bit for bit the same points.
+ */
+static Point sidePoint(std::array<Point, 4> p, int k, int segments) {
+  auto less = [](const Point& a, const Point& b) {
+    return std::tie(a.x, a.y, a.z) < std::tie(b.x, b.y, b.z);
+  };
+  if (std::lexicographical_compare(p.rbegin(), p.rend(), p.begin(), p.end(),
+                                   less)) {
+    std::reverse(p.begin(), p.end());
+    k = segments - k;
+  }
+  float t = static_cast<float>(k) / segments;
+  Point result(0, 0, 0);
+  for (int i = 0; i < 4; ++i) {
+    float basis = bernstein(i, t);
+    result.x += p[i].x * basis;
+    result.y += p[i].y * basis;
+    result.z += p[i].z * basis;
+  }
+  return result;
+}
+
+// Second derivative of the Bernstein polynomial i at t
+static float bernsteinSecondDerivative(int i, float t) {
+  const float derivatives[] = {6 * (1 - t), 18 * t - 12, 6 - 18 * t, 6 * t};
+  return derivatives[i];
+}
+
+/**
+ * Largest second derivatives of a patch, |∂²/∂u²|, |∂²/∂u∂v| and |∂²/∂v²|,
+ * over a grid of CURVATURE_SAMPLES² points. Much closer than the bounds
+ * from the control points, which can be several times too large.
+ */
+static void secondDerivatives(const PatchPoints& G, float& uu, float& uv,
+                              float& vv) {
+  for (int a = 0; a < CURVATURE_SAMPLES; ++a) {
+    for (int b = 0; b < CURVATURE_SAMPLES; ++b) {
+      float u = static_cast<float>(a) / (CURVATURE_SAMPLES - 1);
+      float v = static_cast<float>(b) / (CURVATURE_SAMPLES - 1);
+      Point suu(0, 0, 0), suv(0, 0, 0), svv(0, 0, 0);
+      for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+          const Point& p = G[i * 4 + j];
+          float wuu = bernsteinSecondDerivative(i, u) * bernstein(j, v);
+          float wuv = bernsteinDerivative(i, u) * bernsteinDerivative(j, v);
+          float wvv = bernstein(i, u) * bernsteinSecondDerivative(j, v);
+          suu = Point(suu.x + wuu * p.x, suu.y + wuu * p.y, suu.z + wuu * p.z);
+          suv = Point(suv.x + wuv * p.x, suv.y + wuv * p.y, suv.z + wuv * p.z);
+          svv = Point(svv.x + wvv * p.x, svv.y + wvv * p.y, svv.z + wvv * p.z);
+        }
+      }
+      uu = std::max(uu, length(suu));
+      uv = std::max(uv, length(suv));
+      vv = std::max(vv, length(svv));
+    }
+  }
+}
+
+/**
+ * Tessellates one patch so that no triangle strays more than maxError from
+ * it. Each side is split by its own curvature, and the inside is a grid of
+ * nu × nv quads sized by the bound of Filip et al. on the second
+ * derivatives:
+ *   (Muu / nu² + 2 Muv / (nu nv) + Mvv / nv²) / 8 ≤ maxError
+ * A strip of triangles joins the ring of inner vertices to the sides.
+ */
+static void tessellateAdaptive(const PatchPoints& G, float maxError,
+                               IndexedMesh& mesh) {
+  float uu = 0.0f, uv = 0.0f, vv = 0.0f;
+  secondDerivatives(G, uu, uv, vv);
+  // The fewest quads share the error as nu / nv = √(Muu / Mvv), which gives
+  // nu = √Muu s and nv = √Mvv s with s² = (1 + Muv / √(Muu Mvv)) / (4 e)
+  float a = std::sqrt(uu), b = std::sqrt(vv), c = uv;
+  float least = 1e-3f * std::max({a, b, std::sqrt(c)});
+  int nu = 1, nv = 1;
+  if (least > 0.0f) {
+    a = std::max(a, least);
+    b = std::max(b, least);
+    float s = std::sqrt((1.0f + c / (a * b)) / (4.0f * maxError));
+    nu = segmentCount(a * s);
+    nv = segmentCount(b * s);
+  }
+  // At least one inner vertex for the sides to meet
+  nu = std::max(nu, 2);
+  nv = std::max(nv, 2);
+
+  auto vertex = [&](float u, float v, const Point& point) {
+    Point normal = surfaceNormal(G, u, v, bezierPatchDU(G, u, v),
+                                 bezierPatchDV(G, u, v));
+    return mesh.addVertex(point, normal, Point2D(u, v));
+  };
+
+  // Outer ring, counterclockwise from (0, 0), each side from its first
+  // corner to the next
+  std::array<std::vector<unsigned int>, 4> sides;
+  std::array<int, 4> segments;
+  for (int side = 0; side < 4; ++side) {
+    std::array<Point, 4> points = sidePoints(G, side);
+    segments[side] = sideSegments(points, maxError);
+    for (int k = 0; k < segments[side]; ++k) {
+      // Sides 2 and 3 run against their parameter
+      bool back = side >= 2;
+      int step = back ? segments[side] - k : k;
+      float t = static_cast<float>(step) / segments[side];
+      const float u[] = {t, 1.0f, t, 0.0f}, v[] = {0.0f, t, 1.0f, t};
+      sides[side].push_back(
+          vertex(u[side], v[side], sidePoint(points, step, segments[side])));
+    }
+  }
+  for (int side = 0; side < 4; ++side) {
+    sides[side].push_back(sides[(side + 1) % 4].front());
+  }
+
+  // Inner grid, at u = i / nu and v = j / nv for 0 < i < nu and 0 < j < nv
+  const int columns = nv - 1;
+  const unsigned int first = mesh.vertexCount();
+  for (int i = 1; i < nu; ++i) {
+    for (int j = 1; j < nv; ++j) {
+      float u = static_cast<float>(i) / nu, v = static_cast<float>(j) / nv;
+      vertex(u, v, bezierPatch(G, u, v));
+    }
+  }
+  auto inner = [&](int i, int j) {
+    return first + (i - 1) * columns + (j - 1);
+  };
+
+  // Triangles come counterclockwise in (u, v) and are flipped to match the
+  // winding of tessellateRange
+  auto triangle = [&](unsigned int a, unsigned int b, unsigned int c) {
+    mesh.addTriangle(a, c, b);
+  };
+  for (int i = 1; i < nu - 1; ++i) {
+    for (int j = 1; j < nv - 1; ++j) {
+      unsigned int a = inner(i, j), b = inner(i + 1, j);
+      unsigned int c = inner(i + 1, j + 1), d = inner(i, j + 1);
+      triangle(a, b, c);
+      triangle(a, c, d);
+    }
+  }
+
+  // Inner ring along each side, in the same direction, with the position
+  // of every vertex along the side
+  for (int side = 0; side < 4; ++side) {
+    std::vector<std::pair<unsigned int, float>> ring;
+    int count = side % 2 == 0 ? nu - 1 : nv - 1;
+    for (int k = 0; k < count; ++k) {
+      switch (side) {
+        case 0:
+          ring.emplace_back(inner(k + 1, 1), static_cast<float>(k + 1) / nu);
+          break;
+        case 1:
+          ring.emplace_back(inner(nu - 1, k + 1),
+                            static_cast<float>(k + 1) / nv);
+          break;
+        case 2:
+          ring.emplace_back(inner(nu - 1 - k, nv - 1),
+                            1.0f - static_cast<float>(nu - 1 - k) / nu);
+          break;
+        default:
+          ring.emplace_back(inner(1, nv - 1 - k),
+                            1.0f - static_cast<float>(nv - 1 - k) / nv);
+      }
+    }
+
+    // Walks both rows, always advancing the one whose next vertex comes
+    // first along the side
+    const std::vector<unsigned int>& outer = sides[side];
+    size_t k = 0, m = 0;
+    while (k + 1 < outer.size() || m + 1 < ring.size()) {
+      bool advanceOuter =
+          m + 1 == ring.size() ||
+          (k + 1 < outer.size() &&
+           static_cast<float>(k + 1) / segments[side] <= ring[m + 1].second);
+      if (advanceOuter) {
+        triangle(outer[k], outer[k + 1], ring[m].first);
+        k++;
+      } else {
+        triangle(outer[k], ring[m + 1].first, ring[m].first);
+        m++;
+      }
+    }
+  }
+}
+
+void tessellatePatchesAdaptive(const std::vector<PatchPoints>& patches,
+                               float maxError, MeshSink& mesh) {
+  if (!(maxError > 0.0f)) {
+    std::cerr << "The maximum error must be positive" << std::endl;
+    return;
+  }
+  std::vector<IndexedMesh> pieces(patches.size());
+  runJobs(patches.size(), [&](size_t patch) {
+    tessellateAdaptive(patches[patch], maxError, pieces[patch]);
+  });
+  for (const IndexedMesh& piece : pieces) {
+    piece.copyTo(mesh);
+  }
+}
+
+std::pair<std::pair<std::vector<Point>, std::vector<Point>>,
+          std::vector<Point2D>>
+tessellatePatchesDirect(const std::vector<PatchPoints>& patches,
+                        const int tessellationLevel) {
+  const size_t rowVertices = static_cast<size_t>(tessellationLevel) * 6;
+  const size_t rowCount = patches.size() * tessellationLevel;
+  std::vector<Point> vertices(rowCount * rowVertices);
+  std::vector<Point> normals(rowCount * rowVertices);
+  std::vector<Point2D> texCoords(rowCount * rowVertices);
+
+  runJobs(rowCount, [&](size_t row) {
+    const PatchPoints& currentPatchPoints = patches[row / tessellationLevel];
+    int uStep = static_cast<int>(row % tessellationLevel);
+    size_t out = row * rowVertices;
+
+    for (int vStep = 0; vStep < tessellationLevel; ++vStep, out += 6) {
+      // Calculate parameter values
+      float u1 = static_cast<float>(uStep) / tessellationLevel;
+      float u2 = static_cast<float>(uStep + 1) / tessellationLevel;
+      float v1 = static_cast<float>(vStep) / tessellationLevel;
+      float v2 = static_cast<float>(vStep + 1) / tessellationLevel;
+
+      // Calculate four corner points
+      Point p1 = bezierPatch(currentPatchPoints, u1, v1);
+      Point p2 = bezierPatch(currentPatchPoints, u2, v1);
+      Point p3 = bezierPatch(currentPatchPoints, u1, v2);
+      Point p4 = bezierPatch(currentPatchPoints, u2, v2);
+
+      // Add two triangles (forming a quad)
+      const Point quad[] = {p1, p3, p2, p2, p3, p4};
+      std::copy(quad, quad + 6, vertices.begin() + out);
+
+      // Calculate normals (using surface derivatives)
+      auto calculateNormal = [&](float u, float v) {
+        Point du = bezierPatchDU(currentPatchPoints, u, v);
+        Point dv = bezierPatchDV(currentPatchPoints, u, v);
+        return dv.cross(du).normalize();
+      };
+
+      Point n1 = calculateNormal(u1, v1);
+      Point n2 = calculateNormal(u2, v1);
+      Point n3 = calculateNormal(u1, v2);
+      Point n4 = calculateNormal(u2, v2);
+
+      // Add normals (matching vertex order)
+      const Point quadNormals[] = {n1, n3, n2, n2, n3, n4};
+      std::copy(quadNormals, quadNormals + 6, normals.begin() + out);
+
+      // Add texture coordinates
+      const Point2D quadTexCoords[] = {Point2D(u1, v1), Point2D(u1, v2),
+                                       Point2D(u2, v1), Point2D(u2, v1),
+                                       Point2D(u1, v2), Point2D(u2, v2)};
+      std::copy(quadTexCoords, quadTexCoords + 6, texCoords.begin() + out);
+    }
+  });
+
+  return {{vertices, normals}, texCoords};
+}
+
+void benchmarkPatches(const char* inputFile, const int tessellationLevel) {
+  std::vector<PatchPoints> patches;
+  if (!readPatchFile(inputFile, patches)) {
+    return;
+  }
+
+  // Best of a few runs of each
+  auto time = [&](auto tessellate, auto& result) {
+    double best = 0.0;
+    for (int run = 0; run < 5; ++run) {
+      auto start = std::chrono::steady_clock::now();
+      result = tessellate(patches, tessellationLevel);
+      auto end = std::chrono::steady_clock::now();
+      double ms =
+          std::chrono::duration<double, std::milli>(end - start).count();
+      best = run == 0 ? ms : std::min(best, ms);
+    }
+    return best;
+  };
+  decltype(tessellatePatchesDirect(patches, tessellationLevel)) direct;
+  IndexedMesh grid;
+  double directMs = time(tessellatePatchesDirect, direct);
+  double gridMs = time(
+      [](const std::vector<PatchPoints>& patches, int level) {
+        return tessellatePatches(patches, level);
+      },
+      grid);
+
+  // The direct normals are NaN where the derivatives vanish
+  float positionError = 0.0f, normalError = 0.0f;
+  size_t skipped = 0;
+  const auto& [directVertices, directNormals] = direct.first;
+  for (size_t i = 0; i < directVertices.size(); ++i) {
+    unsigned int vertex = grid.indices[i];
+    const Point &a = directVertices[i], &b = grid.points[vertex];
+    positionError = std::max({positionError, std::abs(a.x - b.x),
+                              std::abs(a.y - b.y), std::abs(a.z - b.z)});
+    const Point &n = directNormals[i], &m = grid.normals[vertex];
+    if (!std::isfinite(n.x) || !std::isfinite(n.y) || !std::isfinite(n.z)) {
+      skipped++;
+      continue;
+    }
+    normalError = std::max({normalError, std::abs(n.x - m.x),
+                            std::abs(n.y - m.y), std::abs(n.z - m.z)});
+  }
+
+  std::cout << patches.size() << " patches at level " << tessellationLevel
+            << ", " << directVertices.size() / 3 << " triangles\n"
+            << "  per quad: " << directMs << " ms\n"
+            << "  grid:     " << gridMs << " ms (" << directMs / gridMs
+            << "x)\n"
+            << "  max position difference: " << positionError << "\n"
+            << "  max normal difference:   " << normalError << " ("
+            << skipped << " degenerate reference normals skipped)"
+            << std::endl;
+}
+
+Point bezierPatch(const PatchPoints& controlPoints, float u, float v) {
+  Point result(0, 0, 0);
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      float basis = bernstein(i, u) * bernstein(j, v);
+      result.x += controlPoints[i * 4 + j].x * basis;
+      result.y += controlPoints[i * 4 + j].y * basis;
+      result.z += controlPoints[i * 4 + j].z * basis;
+    }
+  }
+  return result;
+}
+
+Point bezierPatchDU(const PatchPoints& controlPoints, float u, float v) {
+  Point result(0, 0, 0);
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      float basis = bernsteinDerivative(i, u) * bernstein(j, v);
+      result.x += controlPoints[i * 4 + j].x * basis;
+      result.y += controlPoints[i * 4 + j].y * basis;
+      result.z += controlPoints[i * 4 + j].z * basis;
+    }
+  }
+  return result;
+}
+
+Point bezierPatchDV(const PatchPoints& controlPoints, float u, float v) {
+  Point result(0, 0, 0);
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      float basis = bernstein(i, u) * bernsteinDerivative(j, v);
+      result.x += controlPoints[i * 4 + j].x * basis;
+      result.y += controlPoints[i * 4 + j].y * basis;
+      result.z += controlPoints[i * 4 + j].z * basis;
+    }
+  }
+  return result;
+}
+
+float bernstein(int i, float t) {
+  switch (i) {
+    case 0:
+      return (1 - t) * (1 - t) * (1 - t);  // (1-t)³
+    case 1:
+      return 3 * t * (1 - t) * (1 - t);  // 3t(1-t)²
+    case 2:
+      return 3 * t * t * (1 - t);  // 3t²(1-t)
+    case 3:
+      return t * t * t;  // t³
+    default:
+      return 0;
+  }
+}
+
+float bernsteinDerivative(int i, float t) {
+  switch (i) {
+    case 0:
+      return -3 * (1 - t) * (1 - t);
+    case 1:
+      return 3 * (1 - t) * (1 - t) - 6 * t * (1 - t);
+    case 2:
+      return 6 * t * (1 - t) - 3 * t * t;
+    case 3:
+      return 3 * t * t;
+    default:
+      return 0;
+  }
+}
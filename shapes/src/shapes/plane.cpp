@@ -0,0 +1,48 @@
+#include "shapes/plane.hpp"
+
+#include <utility>
+#include <vector>
+
+#include "utils.hpp"
+
+/**
+ * Generates the vertices, normals, and texture coordinates for a plane
+ *
+ * @param size The length of each side of the square plane
+ * @param divisions Number of subdivisions along each axis
+ * @param plane Receives a grid of (divisions + 1)² shared vertices and two
+ *        triangles per cell
+ */
+void generatePlaneData(float size, int divisions, MeshSink& plane) {
+  const float halfSize = size / 2.0f;
+  const float stepSize = size / divisions;
+  const unsigned int first = plane.vertexCount();
+  const int columns = divisions + 1;
+
+  // Generate grid points (all normals pointing up in Y direction)
+  for (int row = 0; row <= divisions; row++) {
+    for (int col = 0; col <= divisions; col++) {
+      float x = -halfSize + col * stepSize;
+      float z = -halfSize + row * stepSize;
+      plane.addVertex(Point(x, 0.0f, z), Point(0.0f, 1.0f, 0.0f),
+                      Point2D(static_cast<float>(col) / divisions,
+                              static_cast<float>(row) / divisions));
+    }
+  }
+
+  for (int row = 0; row < divisions; row++) {
+    for (int col = 0; col < divisions; col++) {
+      // The four corners of the current grid cell
+      unsigned int bottomLeft = first + row * columns + col;
+      unsigned int bottomRight = bottomLeft + 1;
+      unsigned int topLeft = bottomLeft + columns;
+      unsigned int topRight = topLeft + 1;
+
+      // First triangle (bottom-left to top-left to bottom-right)
+      plane.addTriangle(bottomLeft, topLeft, bottomRight);
+
+      // Second triangle (bottom-right to top-left to top-right)
+      plane.addTriangle(bottomRight, topLeft, topRight);
+    }
+  }
+}
@@ -0,0 +1,45 @@
+#include "shapes/sphere.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "utils.hpp"
+
+// Função que gera os vértices, normais e coordenadas de textura para uma
+// esfera, numa grelha partilhada de (slices + 1) x (stacks + 1) vértices
+void generateSpherePoints(float radius, int slices, int stacks,
+                          MeshSink& sphere) {
+  const unsigned int first = sphere.vertexCount();
+  const int columns = stacks + 1;
+
+  // Vértices: a costura (phi = 2π) e os polos repetem-se com outras
+  // coordenadas de textura
+  for (int i = 0; i <= slices; ++i) {
+    float angleTheta = static_cast<float>(i) * static_cast<float>(M_PI) /
+                       static_cast<float>(slices);
+
+    for (int j = 0; j <= stacks; ++j) {
+      float anglePhi = static_cast<float>(j) * 2.0f *
+                       static_cast<float>(M_PI) / static_cast<float>(stacks);
+
+      Point point(radius * std::sin(angleTheta) * std::sin(anglePhi),
+                  radius * std::cos(angleTheta),
+                  radius * std::sin(angleTheta) * std::cos(anglePhi));
+      sphere.addVertex(point, point.normalize(),
+                       Point2D(anglePhi / (2.0f * static_cast<float>(M_PI)),
+                               angleTheta / static_cast<float>(M_PI)));
+    }
+  }
+
+  // Dois triângulos por quadrado da grelha
+  for (int i = 0; i < slices; ++i) {
+    for (int j = 0; j < stacks; ++j) {
+      unsigned int p1 = first + i * columns + j, p2 = p1 + 1;
+      unsigned int p3 = p1 + columns, p4 = p3 + 1;
+      sphere.addTriangle(p1, p4, p2);
+      sphere.addTriangle(p1, p3, p4);
+    }
+  }
+}